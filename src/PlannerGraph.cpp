@@ -15,72 +15,67 @@ static std::string up(std::string v) {
 }
 
 // ---------------- Graph building ----------------
-bool PlannerService::buildGraph(std::string& err) {
-    adj_.clear();
-    indeg_.clear();
-
-    for (auto& [id, c] : courses_) {
-        if (!indeg_.count(id)) indeg_[id] = 0;
-        for (auto& pre : c.prereqs) {
-            if (!courses_.count(pre)) continue;
-            adj_[pre].push_back(id);
-            indeg_[id]++;
-            if (!indeg_.count(pre)) indeg_[pre] = 0;
+// Đồ thị theo handle của ids_: prereq không có trong curriculum (CEFR/chứng chỉ) bị bỏ
+bool PlannerService::buildGraph(std::string& /*err*/) {
+    const CourseHandle n = static_cast<CourseHandle>(ids_.size());
+    adj_.assign(n, {});
+    prereq_.assign(n, {});
+    indeg_.assign(n, 0);
+    for (CourseHandle v = 0; v < n; ++v) {
+        for (const auto& pre : courses_[v].prereqs) {
+            const CourseHandle u = ids_.find(pre);
+            if (u == CourseIdTable::npos) continue;
+            adj_[u].push_back(v);
+            prereq_[v].push_back(u);
+            indeg_[v]++;
         }
     }
-    for (auto& [id, _] : courses_) if (!adj_.count(id)) adj_[id] = {};
     return true;
 }
 
-// ---------------- Topological sort ----------------
 bool PlannerService::topoSort(std::vector<std::string>& order, std::string& err) const {
     order.clear();
     auto deg = indeg_;
-    std::queue<std::string> q;
-    for (auto& [v, d] : deg) if (d == 0) q.push(v);
-
+    // min-heap theo id: thứ tự chỉ phụ thuộc id, không phụ thuộc handle
+    auto later = [&](CourseHandle a, CourseHandle b) { return ids_.name(a) > ids_.name(b); };
+    std::priority_queue<CourseHandle, std::vector<CourseHandle>, decltype(later)> q(later);
+    for (CourseHandle v = 0; v < deg.size(); ++v) if (deg[v] == 0) q.push(v);
     while (!q.empty()) {
-        auto u = q.front(); q.pop();
-        order.push_back(u);
-        for (auto& v : adj_.at(u))
-            if (--deg[v] == 0) q.push(v);
-    }
-
-    if (order.size() != courses_.size()) {
-        err = "Curriculum has cycles.";
-        return false;
+        const CourseHandle u = q.top(); q.pop();
+        order.push_back(ids_.name(u));
+        for (CourseHandle v : adj_[u]) if (--deg[v] == 0) q.push(v);
     }
+    if (order.size() != courses_.size()) { err = "Curriculum has cycles."; return false; }
     return true;
 }
 
-// ---------------- Cycle detection ----------------
 bool PlannerService::findCycle(std::vector<std::string>& cyc) const {
     cyc.clear();
     enum { W = 0, G = 1, B = 2 };
-    std::unordered_map<std::string, int> col;
-    std::unordered_map<std::string, std::string> par;
-
-    for (auto& [id, _] : courses_) { col[id] = W; par[id] = ""; }
+    std::vector<int> col(ids_.size(), W);
+    std::vector<CourseHandle> par(ids_.size(), CourseIdTable::npos);
 
-    std::function<bool(const std::string&)> dfs = [&](const std::string& u)->bool {
+    std::function<bool(CourseHandle)> dfs = [&](CourseHandle u) -> bool {
         col[u] = G;
-        auto it = adj_.find(u);
-        if (it != adj_.end()) {
-            for (auto& v : it->second) {
-                if (!courses_.count(v)) continue;
-                if (col[v] == W) { par[v] = u; if (dfs(v)) return true; }
-                else if (col[v] == G) {
-                    cyc = {v, u, v};
-                    return true;
-                }
+        for (CourseHandle v : adj_[u]) {
+            if (col[v] == W) { par[v] = u; if (dfs(v)) return true; }
+            else if (col[v] == G) {
+                // dựng lại đủ đường v -> ... -> u -> v theo par
+                std::vector<std::string> path{ids_.name(v)};
+                for (CourseHandle cur = u; cur != v && cur != CourseIdTable::npos; cur = par[cur])
+                    path.push_back(ids_.name(cur));
+                path.push_back(ids_.name(v));
+                std::reverse(path.begin(), path.end());
+                cyc = std::move(path);
+                return true;
             }
         }
         col[u] = B;
         return false;
     };
 
-    for (auto& [id, _] : courses_)
-        if (col[id] == W && dfs(id)) return true;
+    for (CourseHandle u = 0; u < ids_.size(); ++u)
+        if (col[u] == W && dfs(u)) return true;
     return false;
 }
 
@@ -88,6 +83,7 @@ bool PlannerService::findCycle(std::vector<std::string>& cyc) const {
 bool PlannerService::loadCurriculum(const std::string& jsonPath, std::string& err) {
     err.clear();
     courses_.clear();
+    ids_.clear();
     std::ifstream f(jsonPath);
     if (!f) { err = "Cannot open file: " + jsonPath; return false; }
 
@@ -113,20 +109,25 @@ bool PlannerService::loadCurriculum(const std::string& jsonPath, std::string& er
             if (x.contains("prereq") && x["prereq"].is_array()) {
                 for (auto& p : x["prereq"]) c.prereqs.push_back(p.get<std::string>());
             }
-            courses_[c.id] = std::move(c);
+            // id lặp lại: giữ handle lần gặp đầu, nội dung lần cuối
+            const CourseHandle h = ids_.append(c.id);
+            if (h < courses_.size()) courses_[h] = std::move(c);
+            else courses_.push_back(std::move(c));
         }
     } catch (const std::exception& ex) {
         err = std::string("Invalid course entry: ") + ex.what();
+        courses_.clear();
+        ids_.clear();
         return false;
     }
 
     return buildGraph(err);
 }
 
-std::vector<std::string> PlannerService::prereqsOf(const std::string& id) const {
+std::vector<std::string> PlannerService::prereqsOf(const std::string& courseId) const {
     std::vector<std::string> out;
-    auto it = courses_.find(id);
-    if (it == courses_.end()) return out;
-    for (auto& p : it->second.prereqs) if (courses_.count(p)) out.push_back(p);
+    const CourseHandle h = ids_.find(courseId);
+    if (h == CourseIdTable::npos) return out;
+    for (CourseHandle p : prereq_[h]) out.push_back(ids_.name(p));
     return out;
 }
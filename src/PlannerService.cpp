@@ -141,37 +141,35 @@ static inline bool idHasSpecPrefix(const std::string& id, const std::string& key
 }
 
 // ======================= graph build / topo =======================
+// Đồ thị theo handle của ids_: prereq không có trong curriculum (CEFR/chứng chỉ) bị bỏ
 bool PlannerService::buildGraph(std::string& /*err*/) {
-    adj_.clear();
-    indeg_.clear();
-
-    for (auto& [id, c] : courses_) {
-        if (!indeg_.count(id)) indeg_[id] = 0;
-        for (auto& pre : c.prereqs) {
-            if (!courses_.count(pre)) continue; // bỏ CEFR/chứng chỉ
-            adj_[pre].push_back(id);
-            indeg_[id]++;
-            if (!indeg_.count(pre)) indeg_[pre] = 0;
+    const CourseHandle n = static_cast<CourseHandle>(ids_.size());
+    adj_.assign(n, {});
+    prereq_.assign(n, {});
+    indeg_.assign(n, 0);
+    for (CourseHandle v = 0; v < n; ++v) {
+        for (const auto& pre : courses_[v].prereqs) {
+            const CourseHandle u = ids_.find(pre);
+            if (u == CourseIdTable::npos) continue;
+            adj_[u].push_back(v);
+            prereq_[v].push_back(u);
+            indeg_[v]++;
         }
     }
-    for (auto& [id, _] : courses_) if (!adj_.count(id)) adj_[id] = {};
     return true;
 }
 
 bool PlannerService::topoSort(std::vector<std::string>& order, std::string& err) const {
     order.clear();
     auto deg = indeg_;
-    
-// Thuật toán 2.3: Cycle Detection (in-degree check inside Kahn) & 2.2: Kahn's Topological Sorting
-std::queue<std::string> q;
-    for (auto& [v, d] : deg) if (d == 0) q.push(v);
+    // min-heap theo id: thứ tự chỉ phụ thuộc id, không phụ thuộc handle
+    auto later = [&](CourseHandle a, CourseHandle b) { return ids_.name(a) > ids_.name(b); };
+    std::priority_queue<CourseHandle, std::vector<CourseHandle>, decltype(later)> q(later);
+    for (CourseHandle v = 0; v < deg.size(); ++v) if (deg[v] == 0) q.push(v);
     while (!q.empty()) {
-        auto u = q.front(); q.pop();
-        order.push_back(u);
-        auto it = adj_.find(u);
-        if (it != adj_.end())
-            for (auto& v : it->second)
-                if (--deg[v] == 0) q.push(v);
+        const CourseHandle u = q.top(); q.pop();
+        order.push_back(ids_.name(u));
+        for (CourseHandle v : adj_[u]) if (--deg[v] == 0) q.push(v);
     }
     if (order.size() != courses_.size()) { err = "Curriculum has cycles."; return false; }
     return true;
@@ -180,40 +178,40 @@ std::queue<std::string> q;
 bool PlannerService::findCycle(std::vector<std::string>& cyc) const {
     cyc.clear();
     enum { W = 0, G = 1, B = 2 };
-    std::unordered_map<std::string, int> col;
-    std::unordered_map<std::string, std::string> par;
-    for (auto& [id, _] : courses_) { col[id] = W; par[id] = ""; }
+    std::vector<int> col(ids_.size(), W);
+    std::vector<CourseHandle> par(ids_.size(), CourseIdTable::npos);
 
-    std::function<bool(const std::string&)> dfs = [&](const std::string& u)->bool {
+    std::function<bool(CourseHandle)> dfs = [&](CourseHandle u) -> bool {
         col[u] = G;
-        auto it = adj_.find(u);
-        if (it != adj_.end()) for (auto& v : it->second) {
-            if (!courses_.count(v)) continue;
+        for (CourseHandle v : adj_[u]) {
             if (col[v] == W) { par[v] = u; if (dfs(v)) return true; }
             else if (col[v] == G) {
-                std::vector<std::string> path; path.push_back(v);
-                std::string cur = u;
-                while (cur != v && !cur.empty()) { path.push_back(cur); cur = par[cur]; }
-                path.push_back(v);
+                // dựng lại đủ đường v -> ... -> u -> v theo par
+                std::vector<std::string> path{ids_.name(v)};
+                for (CourseHandle cur = u; cur != v && cur != CourseIdTable::npos; cur = par[cur])
+                    path.push_back(ids_.name(cur));
+                path.push_back(ids_.name(v));
                 std::reverse(path.begin(), path.end());
                 cyc = std::move(path);
                 return true;
             }
         }
-        col[u] = B; return false;
+        col[u] = B;
+        return false;
     };
 
-    for (auto& [id, _] : courses_) if (col[id] == W && dfs(id)) return true;
+    for (CourseHandle u = 0; u < ids_.size(); ++u)
+        if (col[u] == W && dfs(u)) return true;
     return false;
 }
 // tìm id theo tên (không phân biệt hoa thường, trả về "" nếu không thấy)
 static std::string findIdByNameContains(
-    const std::unordered_map<std::string, Course>& courses,
+    const std::vector<Course>& courses,
     const std::string& needle)
 {
     std::string upNeedle = up(needle);
-    for (const auto& [id, c] : courses) {
-        if (up(c.name).find(upNeedle) != std::string::npos) return id;
+    for (const auto& c : courses) {
+        if (up(c.name).find(upNeedle) != std::string::npos) return c.id;
     }
     return "";
 }
@@ -246,13 +244,14 @@ static int termIndexOfInPlan(const PlanResult& R, const std::string& id) {
 // Kiểm tra: mọi tiên quyết của 'id' đã đặt ở kỳ < T
 // Thuật toán 2.4: Earliest-Term Computation (đảm bảo mọi tiên quyết đặt ở kỳ < T)
 bool prereqsOkByTerm(const PlanResult& R,
-                     const std::unordered_map<std::string, Course>& courses,
+                     const CourseIdTable& ids,
+                     const std::vector<Course>& courses,
                      const std::string& id,
                      int T) {
-    auto it = courses.find(id);
-    if (it == courses.end()) return false;
-    for (const auto& pre : it->second.prereqs) {
-        if (!courses.count(pre)) continue;     // bỏ qua label ngoại bảng
+    const CourseHandle h = ids.find(id);
+    if (h == CourseIdTable::npos) return false;
+    for (const auto& pre : courses[h].prereqs) {
+        if (!ids.count(pre)) continue;     // bỏ qua label ngoại bảng
         int tp = termIndexOfInPlan(R, pre);
         if (tp == -1 || tp >= T) return false;
     }
@@ -272,7 +271,9 @@ int countSpecInTerm(const PlanResult& R, int t, IsSpecFn isSpecAny) {
 bool PlannerService::loadCurriculum(const std::string& jsonPath, std::string& err) {
     err.clear();
     courses_.clear();
+    ids_.clear();
     adj_.clear();
+    prereq_.clear();
     indeg_.clear();
 
     std::ifstream f(jsonPath);
@@ -297,11 +298,15 @@ bool PlannerService::loadCurriculum(const std::string& jsonPath, std::string& er
             if (x.contains("prereq") && x["prereq"].is_array()) {
                 for (auto& p : x["prereq"]) c.prereqs.push_back(p.get<std::string>());
             }
-            courses_[c.id] = std::move(c);
+            // id lặp lại: giữ handle lần gặp đầu, nội dung lần cuối
+            const CourseHandle h = ids_.append(c.id);
+            if (h < courses_.size()) courses_[h] = std::move(c);
+            else courses_.push_back(std::move(c));
         }
     } catch (const std::exception& ex) {
         err = std::string("Invalid course entry: ") + ex.what();
         courses_.clear();
+        ids_.clear();
         return false;
     }
 
@@ -311,11 +316,9 @@ bool PlannerService::loadCurriculum(const std::string& jsonPath, std::string& er
 // Trả về các mã tiên quyết là “mã môn” có trong curriculum (bỏ CEFR…)
 std::vector<std::string> PlannerService::prereqsOf(const std::string& courseId) const {
     std::vector<std::string> out;
-    auto it = courses_.find(courseId);
-    if (it == courses_.end()) return out;
-    for (const auto& p : it->second.prereqs) {
-        if (courses_.count(p)) out.push_back(p);
-    }
+    const CourseHandle h = ids_.find(courseId);
+    if (h == CourseIdTable::npos) return out;
+    for (CourseHandle p : prereq_[h]) out.push_back(ids_.name(p));
     return out;
 }
 
@@ -340,24 +343,24 @@ PlanResult PlannerService::buildPlan(Specialization spec, int maxCreditsPerTerm)
     const int MAX_PER_TERM = maxCreditsPerTerm;
     const std::string skey = specKey(spec);
 
-    auto isGeneral    = [&](const std::string& id){ return isGeneralTrack(courses_.at(id).track); };
-    auto isITCore     = [&](const std::string& id){ return isITCoreTrack(courses_.at(id).track); };
+    auto isGeneral    = [&](const std::string& id){ return isGeneralTrack(course(id).track); };
+    auto isITCore     = [&](const std::string& id){ return isITCoreTrack(course(id).track); };
     auto isITCoreElec = [&](const std::string& id){ 
-        const auto& c = courses_.at(id);
+        const auto& c = course(id);
         if (kItCoreElectiveIds.count(c.id)) return true;
         // PATCH: không coi track rỗng là IT Core Elective
         // if (c.track.empty()) return true;
         return isITCoreElectiveTrack(c.track);
     };
-    auto isSpecCoreFn = [&](const std::string& id){ return isSpecCore(courses_.at(id), skey); };
+    auto isSpecCoreFn = [&](const std::string& id){ return isSpecCore(course(id), skey); };
     auto isSpecElecFn = [&](const std::string& id){
-        const auto& c = courses_.at(id);
+        const auto& c = course(id);
         const auto keyU = up(skey);
         if (isSpecElectiveForKey(c, keyU)) return true; // tên chứa "Specialized Elective", prefix <SPEC>_SPEC_*
         return isSpecElective(c, skey) || idHasSpecPrefix(c.id, keyU);
     };
     auto isOtherSpecElec = [&](const std::string& id){
-        const auto& c = courses_.at(id); const auto tr = up(c.track);
+        const auto& c = course(id); const auto tr = up(c.track);
         if (tr=="SE"||tr=="NNS"||tr=="IS"||tr=="AI") return !isSpecElecFn(id);
         if (c.id.find("_SPEC_") != std::string::npos) return !isSpecElecFn(id);
         return false;
@@ -372,26 +375,26 @@ PlanResult PlannerService::buildPlan(Specialization spec, int maxCreditsPerTerm)
     int cntITCoreElec = 0, cntSpecElec = 0;
 
     // tình trạng đặt môn
-    std::unordered_map<std::string, bool> placed; for (auto& [id,_] : courses_) placed[id] = false;
+    std::vector<char> placed(courses_.size(), 0); // theo handle
 
     auto fits = [&](int t, const std::string& id){
-        return R.terms[t].totalCredits + courses_.at(id).credits <= MAX_PER_TERM;
+        return R.terms[t].totalCredits + course(id).credits <= MAX_PER_TERM;
     };
     auto place = [&](int t, const std::string& id){
-        const auto& c = courses_.at(id);
+        const auto& c = course(id);
         R.terms[t].courses.push_back({c.id, c.name, c.credits});
         R.terms[t].totalCredits += c.credits;
-        placed[id] = true;
+        placed[ids_.at(id)] = true;
         if (isITCoreElec(id)) ++cntITCoreElec;
         if (isSpecElecFn(id)) ++cntSpecElec;
     };
 auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
-    if (placed[id]) return false;
+    if (placed[ids_.at(id)]) return false;
     // kiểm tra tiên quyết
-    if (!prereqsOkByTerm(R, courses_, id, t)) return false;
+    if (!prereqsOkByTerm(R, ids_, courses_, id, t)) return false;
 
     // kiểm tra trần tín chỉ chuẩn
-    const int add = courses_.at(id).credits;
+    const int add = course(id).credits;
     if (R.terms[t].totalCredits + add > MAX_PER_TERM) return false;
 
     return true;
@@ -420,13 +423,13 @@ auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
     // PATCH: đặt IT Project mặc định ở Kỳ 5 (index 4)
         {
             const std::string itProjId = "PROJ215879E";
-            if (courses_.count(itProjId) && !placed[itProjId]) {
-                const auto& c = courses_.at(itProjId);
+            if (hasCourse(itProjId) && !placed[ids_.at(itProjId)]) {
+                const auto& c = course(itProjId);
                 if (R.terms[t].totalCredits + c.credits <= MAX_PER_TERM &&
-                    prereqsOkByTerm(R, courses_, itProjId, t)) {
+                    prereqsOkByTerm(R, ids_, courses_, itProjId, t)) {
                     R.terms[t].courses.push_back({c.id, c.name, c.credits});
                     R.terms[t].totalCredits += c.credits;
-                    placed[itProjId] = true;
+                    placed[ids_.at(itProjId)] = true;
                 }
             }
         }
@@ -448,26 +451,26 @@ auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
     // gom danh sách AE chưa xếp, theo thứ tự topo (đảm bảo prereq 1→2→3→4)
     std::vector<std::string> aeList;
     for (const auto& id : topo) {
-        auto it = courses_.find(id); if (it == courses_.end()) continue;
-        if (isAcademicEnglish(it->second)) {
-            if (!placed[id]) aeList.push_back(id);
+        if (!hasCourse(id)) continue;
+        if (isAcademicEnglish(course(id))) {
+            if (!placed[ids_.at(id)]) aeList.push_back(id);
         }
     }
 
     auto fits = [&](int t, const std::string& id){
-        return R.terms[t].totalCredits + courses_.at(id).credits <= MAX_PER_TERM;
+        return R.terms[t].totalCredits + course(id).credits <= MAX_PER_TERM;
     };
     auto canPlaceAE = [&](int t, const std::string& id){
-        if (placed[id]) return false;
+        if (placed[ids_.at(id)]) return false;
         if (!fits(t, id)) return false;
-        if (!prereqsOkByTerm(R, courses_, id, t)) return false;
+        if (!prereqsOkByTerm(R, ids_, courses_, id, t)) return false;
         return true;
     };
     auto place = [&](int t, const std::string& id){
-        const auto& c = courses_.at(id);
+        const auto& c = course(id);
         R.terms[t].courses.push_back({c.id, c.name, c.credits});
         R.terms[t].totalCredits += c.credits;
-        placed[id] = true;
+        placed[ids_.at(id)] = true;
     };
 
     for (const auto& aeId : aeList) {
@@ -481,7 +484,7 @@ auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
                 // thử dịch 1 môn không phải AE/Cap/Intern/Spec ra kỳ 6
                 for (int i = (int)R.terms[t].courses.size()-1; i >= 0; --i) {
                     auto mov = R.terms[t].courses[i].id;
-                    const auto& cmov = courses_.at(mov);
+                    const auto& cmov = course(mov);
                     if (isAcademicEnglish(cmov)) continue;
                     if (isCapstoneId(mov) || isInternshipId(mov)) continue;
                     // không dịch môn Spec về trước kỳ 6 (ở đây ta đang trong 1..5 nên ok để đẩy ra sau)
@@ -489,13 +492,13 @@ auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
                     bool pushed = false;
                     for (int tt = 5; tt < 8 && !pushed; ++tt) {
                         if (R.terms[tt].totalCredits + cmov.credits > MAX_PER_TERM) continue;
-                        if (!prereqsOkByTerm(R, courses_, mov, tt)) continue;
+                        if (!prereqsOkByTerm(R, ids_, courses_, mov, tt)) continue;
                         // move
                         R.terms[t].courses.erase(R.terms[t].courses.begin()+i);
                         R.terms[t].totalCredits -= cmov.credits;
                         R.terms[tt].courses.push_back({cmov.id, cmov.name, cmov.credits});
                         R.terms[tt].totalCredits += cmov.credits;
-                        placed[mov] = true; // vốn đã true
+                        placed[ids_.at(mov)] = true; // vốn đã true
                         pushed = true;
                     }
                     if (pushed && canPlaceAE(t, aeId)) { place(t, aeId); done = true; break; }
@@ -508,7 +511,7 @@ auto canPlaceTerm = [&](int t, const std::string& id) -> bool {
 if (cntITCoreElec < PICK_ITCORE_ELECTIVE) {
     for (int t = 0; t <= 4 && cntITCoreElec < PICK_ITCORE_ELECTIVE; ++t) {
         for (const auto& id : topo) {
-            if (placed[id]) continue;
+            if (placed[ids_.at(id)]) continue;
             if (!isITCoreElec(id)) continue;
             if (!canPlaceTerm(t, id)) continue;
             place(t, id);
@@ -533,14 +536,14 @@ if (up(skey) == "SE") {
     };
     for (const auto& kv : seFixed) {
         int term = kv.first; const std::string& cid = kv.second;
-        if (courses_.count(cid)==0) continue;                 // bỏ qua nếu dataset không có
-        if (placed[cid]) continue;                             // đã đặt ở đâu đó thì bỏ qua
-        if (!prereqsOkByTerm(R, courses_, cid, term)) continue; // không phá tiên quyết
-        const auto& c = courses_.at(cid);
+        if (!hasCourse(cid)) continue;                 // bỏ qua nếu dataset không có
+        if (placed[ids_.at(cid)]) continue;                             // đã đặt ở đâu đó thì bỏ qua
+        if (!prereqsOkByTerm(R, ids_, courses_, cid, term)) continue; // không phá tiên quyết
+        const auto& c = course(cid);
         if (R.terms[term].totalCredits + c.credits > MAX_PER_TERM) continue; // không vượt trần
         R.terms[term].courses.push_back({c.id, c.name, c.credits});
         R.terms[term].totalCredits += c.credits;
-        placed[cid] = true;
+        placed[ids_.at(cid)] = true;
         if (isSpecElecFn(cid)) ++cntSpecElec;
     }
 }
@@ -552,18 +555,18 @@ if (up(skey) != "SE") {
     // lấy danh sách spec (không project) theo thứ tự topo
     std::vector<std::string> specList;
     for (const auto& id : topo) {
-        if (placed[id]) continue;
+        if (placed[ids_.at(id)]) continue;
         if (isSpecProjectId(id, skey)) continue;
         if (isSpecCoreFn(id) || isSpecElecFn(id)) specList.push_back(id);
     }
     auto try_place = [&](int term, const std::string& id)->bool{
-        if (placed[id]) return false;
-        if (!prereqsOkByTerm(R, courses_, id, term)) return false;
-        const auto& c = courses_.at(id);
+        if (placed[ids_.at(id)]) return false;
+        if (!prereqsOkByTerm(R, ids_, courses_, id, term)) return false;
+        const auto& c = course(id);
         if (R.terms[term].totalCredits + c.credits > MAX_PER_TERM) return false;
         R.terms[term].courses.push_back({c.id, c.name, c.credits});
         R.terms[term].totalCredits += c.credits;
-        placed[id] = true;
+        placed[ids_.at(id)] = true;
         if (isSpecElecFn(id)) ++cntSpecElec;
         return true;
     };
@@ -575,12 +578,12 @@ if (up(skey) != "SE") {
     }
     // Kỳ 7: đặt phần còn lại
     for (const auto& id : specList) {
-        if (!placed[id]) { (void)try_place(6, id); }
+        if (!placed[ids_.at(id)]) { (void)try_place(6, id); }
     }
     // đặt Project ở Kỳ 7 nếu có và còn chưa đặt
-    for (const auto& kv : courses_) {
-        const std::string& cid = kv.first;
-        if (isSpecProjectId(cid, skey) && !placed[cid]) {
+    for (const auto& c : courses_) {
+        const std::string& cid = c.id;
+        if (isSpecProjectId(cid, skey) && !placed[ids_.at(cid)]) {
             (void)try_place(6, cid);
             break;
         }
@@ -625,21 +628,19 @@ for (int t = 5; t < 7; ++t) {
     // Tìm capId (id hoặc name chứa "CAPSTONE")
     std::string capId = "";
     for (const auto& id : topo) {
-        auto it = courses_.find(id);
-        if (it == courses_.end()) continue;
-        const auto nameU = up(it->second.name);
+        const auto nameU = up(course(id).name);
         if (isCapstoneId(id) || nameU.find("CAPSTONE") != std::string::npos) {
             capId = id; break;
         }
     }
     if (capId.empty()) { R.ok = false; R.message = "Capstone course not found."; return R; }
 
-    auto capCred = courses_.at(capId).credits;
+    auto capCred = course(capId).credits;
 
     auto canPlaceCap = [&](int term)->bool {
-        if (placed[capId]) return false;
+        if (placed[ids_.at(capId)]) return false;
         if (R.terms[term].totalCredits + capCred > MAX_PER_TERM) return false;
-        if (!prereqsOkByTerm(R, courses_, capId, term)) return false;
+        if (!prereqsOkByTerm(R, ids_, courses_, capId, term)) return false;
         return true;
     };
 
@@ -655,13 +656,13 @@ for (int t = 5; t < 7; ++t) {
                 if (isCapstoneId(mvId) || isInternshipId(mvId) || isSpecProjectId(mvId, skey))
                     continue;
 
-                const auto& cmov = courses_.at(mvId);
+                const auto& cmov = course(mvId);
                 // tìm bến đỗ sớm nhất có thể: 0..7 (tránh 8 nếu chính là 8)
                 for (int dst = 0; dst <= 7; ++dst) {
                     if (dst == t) continue;
                     // đủ headroom & đủ tiên quyết
                     if (R.terms[dst].totalCredits + cmov.credits > MAX_PER_TERM) continue;
-                    if (!prereqsOkByTerm(R, courses_, mvId, dst)) continue;
+                    if (!prereqsOkByTerm(R, ids_, courses_, mvId, dst)) continue;
                     // move
                     R.terms[t].courses.erase(R.terms[t].courses.begin()+i);
                     R.terms[t].totalCredits -= cmov.credits;
@@ -680,10 +681,10 @@ for (int t = 5; t < 7; ++t) {
 
         if (!canPlaceCap(t)) {
             // nếu vẫn không đặt được -> báo chi tiết
-            if (!prereqsOkByTerm(R, courses_, capId, t)) {
+            if (!prereqsOkByTerm(R, ids_, courses_, capId, t)) {
                 std::vector<std::string> missing;
-                for (const auto& pre : courses_.at(capId).prereqs) {
-                    if (!courses_.count(pre)) continue;
+                for (const auto& pre : course(capId).prereqs) {
+                    if (!hasCourse(pre)) continue;
                     int tp = termIndexOfInPlan(R, pre);
                     if (tp == -1 || tp >= t) missing.push_back(pre);
                 }
@@ -721,7 +722,7 @@ for (int t = 5; t < 7; ++t) {
             const auto& id = R.terms[from].courses[i].id;
             if (!guard(id)) continue;
             if (!fits(to, id)) continue;
-            if (!prereqsOkByTerm(R, courses_, id, to)) continue;
+            if (!prereqsOkByTerm(R, ids_, courses_, id, to)) continue;
             // không kéo môn chuyên ngành về trước K6
             if (isSpecAny(id) && to < 5) continue;
 
@@ -756,7 +757,7 @@ for (int t = 5; t < 7; ++t) {
     // ======= Validate quotas & unscheduled =======
     // Specialized elective: lấy đúng số môn thực sự có
     int availableSpecElective = 0;
-for (const auto& [cid, c] : courses_) {
+for (const auto& c : courses_) {
     if (isSpecElectiveForKey(c, up(skey))) ++availableSpecElective;
 }
 int needSpecElective = std::min(2, availableSpecElective);
@@ -776,7 +777,7 @@ int needSpecElective = std::min(2, availableSpecElective);
 
     // báo lỗi các môn "áp dụng" mà chưa xếp được
     auto applicable = [&](const std::string& id)->bool {
-        const auto& c = courses_.at(id);
+        const auto& c = course(id);
         // PATCH: bỏ qua placeholder generic SPC_1/SPC_2
         if (up(id).rfind("SPC_", 0) == 0) return false;
         if (isGeneralTrack(c.track)) return true;
@@ -789,9 +790,9 @@ int needSpecElective = std::min(2, availableSpecElective);
         if (isCapstoneId(id) || isInternshipId(id)) return true;
         return false;
     };
-    for (const auto& [id,_] : courses_) if (!placed.at(id) && applicable(id)) {
+    for (CourseHandle h = 0; h < courses_.size(); ++h) if (!placed[h] && applicable(courses_[h].id)) {
         R.ok = false;
-        R.message = "Some courses remain unscheduled after 8 terms (e.g., " + id + ").";
+        R.message = "Some courses remain unscheduled after 8 terms (e.g., " + courses_[h].id + ").";
         return R;
     }
      // 1) Academic English 1..4: nếu có trong curriculum thì bắt buộc đã xếp
@@ -804,7 +805,7 @@ int needSpecElective = std::min(2, availableSpecElective);
             std::string id = findIdByNameContains(courses_, aeNames[i]);
             if (!id.empty()) {
                 // nếu môn tồn tại trong data mà chưa được xếp -> lỗi
-                if (!placed.count(id) || !placed.at(id)) {
+                if (!placed[ids_.at(id)]) {
                     R.ok = false;
                     R.message = "Missing required course: " + aeNames[i] + ".";
                     return R;
@@ -816,8 +817,8 @@ int needSpecElective = std::min(2, availableSpecElective);
     // 2) Project chuyên ngành phải nằm ở kỳ 7 (0-based: index = 6)
     {
         std::string projId = "";
-        for (const auto& kv : courses_) {
-            if (isSpecProjectId(kv.first, skey)) { projId = kv.first; break; }
+        for (const auto& c : courses_) {
+            if (isSpecProjectId(c.id, skey)) { projId = c.id; break; }
         }
         if (!projId.empty()) {
             int tProj = termIndexOfInPlan(R, projId);
@@ -848,9 +849,9 @@ for (int t = 0; t < 8; ++t) {
     };
     auto moveCourse = [&](int from, int to, const std::string& cid)->bool{
         if (from == to || from < 0 || to < 0) return false;
-        const auto& cmv = courses_.at(cid);
+        const auto& cmv = course(cid);
         if (R.terms[to].totalCredits + cmv.credits > MAX_PER_TERM) return false;
-        if (!prereqsOkByTerm(R, courses_, cid, to)) return false;
+        if (!prereqsOkByTerm(R, ids_, courses_, cid, to)) return false;
         for (int i = (int)R.terms[from].courses.size()-1; i >= 0; --i) {
             if (R.terms[from].courses[i].id == cid) {
                 auto moved = R.terms[from].courses[i];
@@ -874,9 +875,9 @@ for (int t = 0; t < 8; ++t) {
                 for (int i = (int)R.terms[6].courses.size()-1; i >= 0; --i) {
                     const auto mv = R.terms[6].courses[i].id;
                     if (isIntern(mv) || isCap(mv) || isSpecProjectId(mv, skey)) continue;
-                    const auto& cmv = courses_.at(mv);
+                    const auto& cmv = course(mv);
                     if (R.terms[7].totalCredits + cmv.credits > MAX_PER_TERM) continue;
-                    if (!prereqsOkByTerm(R, courses_, mv, 7)) continue;
+                    if (!prereqsOkByTerm(R, ids_, courses_, mv, 7)) continue;
                     R.terms[6].courses.erase(R.terms[6].courses.begin()+i);
                     R.terms[6].totalCredits -= cmv.credits;
                     R.terms[7].courses.push_back({cmv.id, cmv.name, cmv.credits});
@@ -890,19 +891,19 @@ for (int t = 0; t < 8; ++t) {
 
     // IT Project -> Kỳ 5 (index 4)
     const std::string itp = "PROJ215879E";
-    if (courses_.count(itp)) {
+    if (hasCourse(itp)) {
         int ti = termIndexOf(itp);
         if (ti != 4 && ti != -1) {
             // nếu K5 đầy: dọn 1 môn thường từ K5 qua K6/K7
-            if (R.terms[4].totalCredits + courses_.at(itp).credits > MAX_PER_TERM) {
+            if (R.terms[4].totalCredits + course(itp).credits > MAX_PER_TERM) {
                 bool freed = false;
                 for (int i = (int)R.terms[4].courses.size()-1; i >= 0 && !freed; --i) {
                     const auto mv = R.terms[4].courses[i].id;
                     if (mv == itp || isIntern(mv) || isCap(mv) || isSpecProjectId(mv, skey)) continue;
-                    const auto& cmv = courses_.at(mv);
+                    const auto& cmv = course(mv);
                     for (int dst : {5,6}) {
                         if (R.terms[dst].totalCredits + cmv.credits > MAX_PER_TERM) continue;
-                        if (!prereqsOkByTerm(R, courses_, mv, dst)) continue;
+                        if (!prereqsOkByTerm(R, ids_, courses_, mv, dst)) continue;
                         R.terms[4].courses.erase(R.terms[4].courses.begin()+i);
                         R.terms[4].totalCredits -= cmv.credits;
                         R.terms[dst].courses.push_back({cmv.id, cmv.name, cmv.credits});
@@ -3,6 +3,7 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include "model/CourseIdTable.h"
 
 struct PlannedCourse {
     std::string id;
@@ -42,11 +43,24 @@ public:
     // Để UI hiển thị cột Prerequisite
     std::vector<std::string> prereqsOf(const std::string& courseId) const;
 
+    // Handle dày 0..n-1 theo thứ tự trong JSON, intern một lần lúc load
+    CourseHandle handleOf(const std::string& courseId) const { return ids_.find(courseId); }
+    const std::string& idOf(CourseHandle h) const { return ids_.name(h); }
+    std::size_t courseCount() const { return ids_.size(); }
+    // prereq của h có trong curriculum (bỏ CEFR/chứng chỉ), theo thứ tự khai báo
+    const std::vector<CourseHandle>& prereqsOf(CourseHandle h) const { return prereq_[h]; }
+
 private:
     // data
-    std::unordered_map<std::string, Course> courses_;               // id -> Course
-    std::unordered_map<std::string, std::vector<std::string>> adj_; // u -> [v,...]
-    std::unordered_map<std::string, int> indeg_;                    // v -> indegree
+    std::vector<Course> courses_;                      // handle -> Course
+    CourseIdTable ids_;                                // id <-> handle
+    std::vector<std::vector<CourseHandle>> adj_;       // u -> [v,...] (theo handle)
+    std::vector<std::vector<CourseHandle>> prereq_;    // v -> [u,...]
+    std::vector<int> indeg_;                           // v -> indegree
+
+    // tra theo id qua ids_ (ném std::out_of_range nếu id lạ)
+    const Course& course(const std::string& id) const { return courses_[ids_.at(id)]; }
+    bool hasCourse(const std::string& id) const { return ids_.count(id) != 0; }
 
     // tag/spec helpers
     static bool isGeneralTrack(std::string t);
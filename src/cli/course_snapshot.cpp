@@ -0,0 +1,75 @@
+// course_snapshot: biên dịch data/*.json thành snapshot nhị phân (xem io/Snapshot.h)
+//
+//   course_snapshot <input.json> <output.snap>
+//
+// Đọc đúng schema của data/: courses[].{id, name, credits, prereq|prerequisite,
+// coreq|corequisite, offered_terms}. Giống RunPlanner, prereq không có trong bảng
+// (CEFR/chứng chỉ) bị bỏ qua.
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "graph/CourseGraph.h"
+#include "io/Snapshot.h"
+#include "model/Curriculum.h"
+
+using nlohmann::json;
+
+static std::vector<std::string> knownIds(const json& c, const char* key, const char* alt,
+                                         const std::unordered_set<std::string>& known) {
+    std::vector<std::string> out;
+    const char* k = c.contains(key) ? key : alt;
+    if (!c.contains(k)) return out;
+    for (const auto& x : c[k]) {
+        std::string id = x.get<std::string>();
+        if (known.count(id)) out.push_back(id);
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <input.json> <output.snap>\n";
+        return 2;
+    }
+    try {
+        std::ifstream in(argv[1]);
+        if (!in) throw std::runtime_error(std::string("Cannot open file: ") + argv[1]);
+        json J; in >> J;
+        if (!J.contains("courses") || !J["courses"].is_array())
+            throw std::runtime_error("JSON missing 'courses' array");
+
+        std::unordered_set<std::string> known;
+        for (const auto& c : J["courses"]) known.insert(c.at("id").get<std::string>());
+
+        std::vector<Course> courses;
+        for (const auto& c : J["courses"]) {
+            Course course{};
+            course.id = c.at("id").get<std::string>();
+            course.name = c.value("name", course.id);
+            course.credits = c.value("credits", (unsigned short)0);
+            course.prerequisite = knownIds(c, "prereq", "prerequisite", known);
+            course.corequisite = knownIds(c, "coreq", "corequisite", known);
+            if (c.contains("offered_terms")) {
+                for (const auto& t : c["offered_terms"]) course.offered_terms.insert(t.get<unsigned short>());
+            }
+            courses.push_back(std::move(course));
+        }
+        Curriculum cur(std::move(courses));
+        CourseGraph g;
+        g.build(cur);
+        planner::writeSnapshot(argv[2], cur, g);
+
+        planner::Snapshot snap = planner::Snapshot::open(argv[2]);
+        std::cout << argv[2] << ": " << snap.numCourses() << " courses, " << snap.numEdges()
+                  << " edges, " << snap.sizeBytes() << " bytes"
+                  << (snap.hasOrder() ? "" : " (cycle: no topo order / earliest terms)") << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+// topo_bench: so vòng Kahn cũ (queue + --indeg rẽ nhánh) với topoSort (kernel
+// IndegreeKernel) trên DAG ngẫu nhiên dày
+//
+//   topo_bench [V] [avgDegree] [repeats]     (mặc định 20000 64 20)
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "graph/CourseGraph.h"
+#include "graph/TopoSort.h"
+
+static std::vector<int> legacyTopo(const CourseGraph& g) {
+    std::vector<int> indeg = g.indeg, order;
+    std::queue<int> q;
+    for (int u = 0; u < g.V; u++) {
+        if (indeg[u] == 0) q.push(u);
+    }
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        order.push_back(u);
+        for (int v : g.adj[u]) {
+            if (--indeg[v] == 0) q.push(v);
+        }
+    }
+    return order;
+}
+
+template <class F>
+static double bestMs(int repeats, F&& run) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; r++) {
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::milli> dt = std::chrono::steady_clock::now() - t0;
+        if (dt.count() < best) best = dt.count();
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    const int V = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const int deg = argc > 2 ? std::atoi(argv[2]) : 64;
+    const int repeats = argc > 3 ? std::atoi(argv[3]) : 20;
+    if (V < 2 || deg < 1 || repeats < 1) {
+        std::cerr << "usage: " << argv[0] << " [V>=2] [avgDegree>=1] [repeats>=1]\n";
+        return 2;
+    }
+
+    // Cạnh luôn đi từ idx nhỏ sang idx lớn -> DAG
+    std::vector<std::string> ids(V);
+    for (int i = 0; i < V; i++) ids[i] = "N" + std::to_string(i);
+    std::vector<int> from, to;
+    unsigned x = 2024;
+    for (long long e = 0; e < (long long)V * deg; e++) {
+        x = x * 1103515245u + 12345u;
+        int a = (int)((x >> 8) % V);
+        x = x * 1103515245u + 12345u;
+        int b = (int)((x >> 8) % V);
+        if (a == b) continue;
+        from.push_back(a < b ? a : b);
+        to.push_back(a < b ? b : a);
+    }
+    CourseGraph g;
+    g.buildFromEdges(ids, from, to);
+    std::cout << "V=" << g.V << " E=" << g.E << "\n";
+
+    const std::vector<int> ref = legacyTopo(g);
+    const double base = bestMs(repeats, [&] { legacyTopo(g); });
+    std::cout << "  legacy queue      " << base << " ms\n";
+    if (topoSort(g).order != ref) {
+        std::cerr << "order mismatch\n";
+        return 1;
+    }
+    const double ms = bestMs(repeats, [&] { topoSort(g); });
+    std::cout << "  topoSort          " << ms << " ms  (x" << base / ms << ")\n";
+    return 0;
+}
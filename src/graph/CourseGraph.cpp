@@ -1,43 +1,145 @@
 #include "CourseGraph.h"
+#include "util/ThreadPool.h"
+#include <algorithm>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
-void CourseGraph::build(const Curriculum& cur) {
-    // 1) Map id -> idx & idx -> id
-    idToIdx.clear();
-    idxToId.clear();
+void CsrAdjacency::assign(int V, const std::vector<int>& src, const std::vector<int>& dst) {
+    const int E = static_cast<int>(src.size());
 
-    cur.for_each([&](const Course& c) {
-        if (c.id.empty()) {
-            throw std::runtime_error("CourseGraph: empty id");
+    // Pass 1: đếm bậc mỗi hàng rồi cộng dồn thành offset
+    offset.assign(V + 1, 0);
+    for (int e = 0; e < E; ++e) offset[src[e] + 1]++;
+    for (int u = 0; u < V; ++u) offset[u + 1] += offset[u];
+
+    // Pass 2: rải cạnh vào đúng hàng (ổn định theo thứ tự e)
+    target.assign(E, 0);
+    std::vector<int> cursor(offset.begin(), offset.end() - 1);
+    for (int e = 0; e < E; ++e) target[cursor[src[e]]++] = dst[e];
+}
+
+void CsrAdjacency::assign(int V, const std::vector<int>& src, const std::vector<int>& dst, ThreadPool& pool) {
+    const int E = static_cast<int>(src.size());
+    const int P = pool.size();
+    // Ít cạnh hoặc một thread: histogram riêng mỗi khối không đáng
+    if (P == 1 || E < (1 << 16)) {
+        assign(V, src, dst);
+        return;
+    }
+    const int chunk = (E + P - 1) / P;
+
+    // Pass 1: mỗi khối cạnh đếm vào histogram riêng cnt[w][u]
+    std::vector<std::vector<int>> cnt(P, std::vector<int>(V, 0));
+    pool.parallelFor(P, 1, [&](int b, int e, int) {
+        for (int w = b; w < e; ++w) {
+            auto& c = cnt[w];
+            const int last = std::min(E, (w + 1) * chunk);
+            for (int i = w * chunk; i < last; ++i) c[src[i]]++;
         }
-        if (idToIdx.count(c.id)) {
-            throw std::runtime_error(std::string("CourseGraph: duplicate id: ") + c.id);
+    });
+
+    // offset theo hàng; cnt[w][u] đổi thành vị trí bắt đầu của khối w trong hàng u
+    offset.assign(V + 1, 0);
+    for (int u = 0; u < V; ++u) {
+        int sum = 0;
+        for (int w = 0; w < P; ++w) sum += cnt[w][u];
+        offset[u + 1] = offset[u] + sum;
+    }
+    pool.parallelFor(V, 4096, [&](int b, int e, int) {
+        for (int u = b; u < e; ++u) {
+            int at = offset[u];
+            for (int w = 0; w < P; ++w) {
+                const int c = cnt[w][u];
+                cnt[w][u] = at;
+                at += c;
+            }
         }
-        int idx = static_cast<int>(idToIdx.size());
-        idToIdx.emplace(c.id, idx);
-        idxToId.push_back(c.id);
-    }); 
+    });
+
+    // Pass 2: rải cạnh; khối trước nằm trước trong hàng nên giữ thứ tự e như bản tuần tự
+    target.assign(E, 0);
+    pool.parallelFor(P, 1, [&](int b, int e, int) {
+        for (int w = b; w < e; ++w) {
+            auto& cursor = cnt[w];
+            const int last = std::min(E, (w + 1) * chunk);
+            for (int i = w * chunk; i < last; ++i) target[cursor[src[i]]++] = dst[i];
+        }
+    });
+}
+
+void CourseGraph::build(const Curriculum& cur) {
+    // 1) Dùng lại bảng intern của Curriculum (đã từ chối id rỗng / trùng): idx = handle
+    idToIdx = cur.ids();
+    idxToId = idToIdx.names();
 
-    // 2) Khởi tạo khung đồ thị
-    V = static_cast<int>(idToIdx.size());
-    adj.assign(V, {});   // V danh sách kề rỗng
-    indeg.assign(V, 0);  // V số 0
+    V = static_cast<int>(idxToId.size());
 
-    // 3) Thêm cạnh prereq -> course, tính indeg
+    // 2) Resolve prereq -> course thành danh sách cạnh (mỗi cạnh hash đúng 1 lần)
+    std::vector<int> from, to;
+    offeredMask.assign(V, 0);
+    int u = 0; // course (đích), cùng thứ tự với bước 1
     cur.for_each([&](const Course& c) {
-        const int u = idToIdx.at(c.id); // course (đích)
+        for (unsigned short t : c.offered_terms) {
+            if (t < 1 || t > 64) {
+                throw std::runtime_error(
+                    "CourseGraph: offered term " + std::to_string(t) + " of '" + c.id + "' outside [1..64]"
+                );
+            }
+            offeredMask[u] |= std::uint64_t(1) << (t - 1);
+        }
         for (const auto& preId : c.prerequisite) {
-            auto it = idToIdx.find(preId);
-            if (it == idToIdx.end()) {
+            const CourseHandle pre = idToIdx.find(preId);
+            if (pre == CourseIdTable::npos) {
                 throw std::runtime_error(
                     std::string("CourseGraph: unknown prerequisite '") + preId +
                     "' required by '" + c.id + "'"
                 );
             }
-            const int v = it->second;   // prereq (nguồn)
-            adj[v].push_back(u);        // v -> u
-            indeg[u]++;
+            from.push_back(static_cast<int>(pre)); // prereq (nguồn)
+            to.push_back(u);
         }
+        ++u;
     });
+    E = static_cast<int>(from.size());
+
+    // 3) CSR xuôi (v -> u) và ngược (u <- v); indeg[u] = bậc hàng u của radj
+    adj.assign(V, from, to);
+    radj.assign(V, to, from);
+    indeg.assign(V, 0);
+    for (int x = 0; x < V; ++x) indeg[x] = radj.degree(x);
+}
+
+void CourseGraph::buildFromEdges(std::vector<std::string> ids,
+                                 const std::vector<int>& from,
+                                 const std::vector<int>& to,
+                                 ThreadPool* pool) {
+    if (from.size() != to.size()) {
+        throw std::runtime_error("CourseGraph: edge arrays differ in size");
+    }
+    for (const auto& id : ids) {
+        if (id.empty()) {
+            throw std::runtime_error("CourseGraph: empty id");
+        }
+    }
+    idToIdx.build(ids); // hash theo node, không theo cạnh; ném nếu trùng id
+    idxToId = std::move(ids);
+    V = static_cast<int>(idxToId.size());
+    E = static_cast<int>(from.size());
+    for (int e = 0; e < E; ++e) {
+        if (from[e] < 0 || from[e] >= V || to[e] < 0 || to[e] >= V) {
+            throw std::runtime_error("CourseGraph: edge " + std::to_string(e) + " endpoint out of range");
+        }
+    }
+
+    if (pool) {
+        adj.assign(V, from, to, *pool);
+        radj.assign(V, to, from, *pool);
+    } else {
+        adj.assign(V, from, to);
+        radj.assign(V, to, from);
+    }
+    indeg.assign(V, 0);
+    for (int x = 0; x < V; ++x) indeg[x] = radj.degree(x);
+    offeredMask.assign(V, 0);
 }
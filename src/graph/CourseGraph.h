@@ -1,25 +1,103 @@
 /*
  * CourseGraph
- * - V: số đỉnh
- * - adj[v]: danh sách u sao cho v -> u (prereq -> course)
+ * - V: số đỉnh, E: số cạnh
+ * - adj[v]: danh sách u sao cho v -> u (prereq -> course), lưu dạng CSR
+ * - radj[u]: danh sách v sao cho v -> u (prereqs of u), lưu dạng CSR
  * - indeg[u]: số cạnh vào u
- * - idToIdx: id -> index
+ * - idToIdx: id -> index (CourseIdTable, perfect hash dựng lúc build)
  * - idxToId: index -> id (debug/in kết quả)
  *
+ * CSR (compressed sparse row): offset[V+1] + target[E], hàng u nằm ở
+ * target[offset[u] .. offset[u+1]). Mọi pass chỉ đọc 2 mảng liên tục,
+ * không còn một lần cấp phát heap cho mỗi đỉnh.
+ *
+ * - offeredMask[u]: kỳ mở của u, bit (t-1) = kỳ t (giống Snapshot); 0 = mở mọi kỳ.
+ *   nextOfferedTerm / prevOfferedTerm nhảy tới kỳ mở gần nhất bằng ctz / clz.
+ *
+ * buildFromEdges: đường nhanh khi đã có bảng cạnh (prereq_idx, course_idx)
+ * dạng số nguyên: không hash theo cạnh, chỉ counting sort O(V + E); truyền
+ * ThreadPool để đếm / rải cạnh song song theo khối (kết quả giống bản tuần tự).
+ *
  * AC: Interface đủ cho topo sort, longest path, cycle detection.
  */
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <vector>
-#include <unordered_map>
 #include <string>
+#include "model/CourseIdTable.h"
 #include "model/Curriculum.h"
+#include "util/Bits.h"
+
+class ThreadPool;
+
+// Kỳ mở sớm nhất >= t (t >= 1); 0 nếu không còn kỳ nào
+inline int nextOfferedTerm(std::uint64_t mask, int t) {
+    if (mask == 0) return t;
+    if (t > 64) return 0;
+    const std::uint64_t s = mask >> (t - 1);
+    if (s == 0) return 0;
+    return t + lowestBit(s);
+}
+
+// Kỳ mở muộn nhất <= t; 0 nếu không có
+inline int prevOfferedTerm(std::uint64_t mask, int t) {
+    if (mask == 0) return t;
+    if (t < 1) return 0;
+    const std::uint64_t s = t >= 64 ? mask : mask & ((std::uint64_t(1) << t) - 1);
+    if (s == 0) return 0;
+    return highestBit(s) + 1;
+}
+
+struct CsrAdjacency {
+    std::vector<int> offset; // size V+1
+    std::vector<int> target; // size E
+
+    // View chỉ đọc trên một hàng, dùng được như vector trong range-for
+    struct Row {
+        const int* first = nullptr;
+        const int* last = nullptr;
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+        std::size_t size() const { return static_cast<std::size_t>(last - first); }
+        bool empty() const { return first == last; }
+        int operator[](std::size_t i) const { return first[i]; }
+    };
+
+    Row operator[](int u) const {
+        const int* base = target.data();
+        return Row{base + offset[u], base + offset[u + 1]};
+    }
+    int degree(int u) const { return offset[u + 1] - offset[u]; }
+    std::size_t size() const { return offset.empty() ? 0 : offset.size() - 1; }
+    bool empty() const { return size() == 0; }
+
+    // Counting sort (src, dst) -> CSR theo src; giữ thứ tự xuất hiện trong mỗi hàng
+    void assign(int V, const std::vector<int>& src, const std::vector<int>& dst);
+    // Như trên nhưng đếm + rải theo khối cạnh trên pool (mỗi khối một histogram riêng)
+    void assign(int V, const std::vector<int>& src, const std::vector<int>& dst, ThreadPool& pool);
+};
+
 struct CourseGraph {
     int V = 0;
-    std::vector<std::vector<int>> adj;
+    int E = 0;
+    CsrAdjacency adj;   // out-edges: prereq -> course
+    CsrAdjacency radj;  // in-edges:  course <- prereq
     std::vector<int> indeg;
-    std::unordered_map<std::string, int> idToIdx;
+    std::vector<std::uint64_t> offeredMask; // size V (rỗng = mở mọi kỳ)
+    CourseIdTable idToIdx;
     std::vector<std::string> idxToId;
 
+    std::uint64_t offered(int u) const { return offeredMask.empty() ? 0 : offeredMask[u]; }
+
+    // Ném std::runtime_error nếu offered_terms có kỳ ngoài [1..64]
     void build(const Curriculum& cur);
-};
\ No newline at end of file
+    // ids[i] là id của idx i; cạnh thứ e: from[e] (prereq) -> to[e] (course).
+    // Ném std::runtime_error nếu id rỗng / trùng hoặc đầu mút nằm ngoài [0, V).
+    // offeredMask để 0 (mở mọi kỳ).
+    void buildFromEdges(std::vector<std::string> ids,
+                        const std::vector<int>& from,
+                        const std::vector<int>& to,
+                        ThreadPool* pool = nullptr);
+};
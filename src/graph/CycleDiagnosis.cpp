@@ -1,40 +1,244 @@
 #include "CycleDiagnosis.h"
 #include <algorithm>
+#include <utility>
 using namespace std;
-static bool dfs(int u, const CourseGraph& g, vector<int>& color, vector<int>& parent, vector<int>& outCycle) {
-    color[u] = 1;
-    for (int v : g.adj[u]) {
-        if (color[v] == 0) {
-            parent[v] = u;
-            if (dfs(v, g, color, parent, outCycle)) {
-                return true;
+
+// DFS bằng stack tường minh (không đệ quy) để chuỗi prereq dài không tràn stack
+vector<int> findOneCycle(const CourseGraph& g) {
+    const int V = g.V;
+    vector<int> color(V, 0), parent(V, -1);
+    vector<pair<int, int>> st; // (node, vị trí cạnh kế tiếp)
+    for (int root = 0; root < V; root++) {
+        if (color[root] != 0) continue;
+        color[root] = 1;
+        st.emplace_back(root, 0);
+        while (!st.empty()) {
+            const int u = st.back().first;
+            const auto row = g.adj[u];
+            if (st.back().second == (int)row.size()) {
+                color[u] = 2;
+                st.pop_back();
+                continue;
             }
-        }else if (color[v] == 1) {
-            outCycle.clear();
-            int x = u;
-            outCycle.push_back(v);
-            while (x != v && x != -1) {
-                outCycle.push_back(x);
-                x = parent[x];
+            const int v = row[st.back().second++];
+            if (color[v] == 0) {
+                parent[v] = u;
+                color[v] = 1;
+                st.emplace_back(v, 0);
+            } else if (color[v] == 1) {
+                vector<int> cycle{v};
+                for (int x = u; x != v; x = parent[x]) cycle.push_back(x);
+                reverse(cycle.begin(), cycle.end());
+                return cycle;
             }
-            if (x == v) {
-                reverse(outCycle.begin(), outCycle.end());
-            }else {
-                outCycle.clear();
+        }
+    }
+    return {};
+}
+
+namespace {
+// Tarjan lặp trên tập con nodes; inSet(w) lọc node được đi tới.
+// index/low/onStack cỡ V, được trả về -1/0 cho các node đã chạm khi xong.
+struct Tarjan {
+    const CourseGraph& g;
+    vector<int> index, low, st;
+    vector<char> onStack;
+    vector<pair<int, int>> call; // (node, vị trí cạnh kế tiếp)
+
+    explicit Tarjan(const CourseGraph& graph)
+        : g(graph), index(graph.V, -1), low(graph.V, 0), onStack(graph.V, 0) {}
+
+    template <class InSet, class Emit>
+    void run(const vector<int>& nodes, InSet inSet, Emit emit) {
+        int counter = 0;
+        for (int root : nodes) {
+            if (index[root] != -1) continue;
+            index[root] = low[root] = counter++;
+            st.push_back(root);
+            onStack[root] = 1;
+            call.emplace_back(root, 0);
+
+            while (!call.empty()) {
+                const int v = call.back().first;
+                const auto row = g.adj[v];
+                if (call.back().second < (int)row.size()) {
+                    const int w = row[call.back().second++];
+                    if (!inSet(w)) continue;
+                    if (index[w] == -1) {
+                        index[w] = low[w] = counter++;
+                        st.push_back(w);
+                        onStack[w] = 1;
+                        call.emplace_back(w, 0);
+                    } else if (onStack[w]) {
+                        low[v] = min(low[v], index[w]);
+                    }
+                    continue;
+                }
+
+                // v xong: nếu là gốc SCC thì bóc SCC khỏi stack
+                if (low[v] == index[v]) {
+                    vector<int> comp;
+                    int w;
+                    do {
+                        w = st.back();
+                        st.pop_back();
+                        onStack[w] = 0;
+                        comp.push_back(w);
+                    } while (w != v);
+
+                    bool hasCycle = comp.size() > 1;
+                    if (!hasCycle) {
+                        const auto self = g.adj[v];
+                        hasCycle = find(self.begin(), self.end(), v) != self.end();
+                    }
+                    emit(move(comp), hasCycle);
+                }
+                call.pop_back();
+                if (!call.empty()) {
+                    const int p = call.back().first;
+                    low[p] = min(low[p], low[v]);
+                }
             }
-            return true;
         }
+        for (int u : nodes) index[u] = -1;
     }
-    color[u] = 2;
-    return false;
+};
 }
-vector<int> findOneCycle(const CourseGraph& g) {
+
+SccDecomposition findSccs(const CourseGraph& g) {
     const int V = g.V;
-    vector<int> color(V, 0), parent(V, -1), cycle;
-    for (int u = 0; u < V; u++) {
-        if (color[u] == 0) {
-            if (dfs(u, g, color, parent, cycle)) return cycle;
+    SccDecomposition res;
+    res.compOf.assign(V, -1);
+    vector<int> all(V);
+    for (int u = 0; u < V; u++) all[u] = u;
+
+    Tarjan t(g);
+    t.run(all, [](int) { return true; }, [&](vector<int> comp, bool hasCycle) {
+        for (int w : comp) res.compOf[w] = res.count;
+        if (hasCycle) {
+            sort(comp.begin(), comp.end());
+            res.cyclic.push_back(move(comp));
+        }
+        res.count++;
+    });
+    return res;
+}
+
+namespace {
+// Trạng thái Johnson dùng lại giữa các SCC (mảng cỡ V, chỉ dọn phần đã chạm)
+struct Johnson {
+    const CourseGraph& g;
+    vector<int> member; // nhãn tập con đang xét; -1 = ngoài tập
+    vector<char> blocked;
+    vector<vector<int>> B;
+    vector<int> path;
+
+    explicit Johnson(const CourseGraph& graph)
+        : g(graph), member(graph.V, -1), blocked(graph.V, 0), B(graph.V) {}
+
+    void unblock(int u) {
+        vector<int> st{u};
+        while (!st.empty()) {
+            int x = st.back();
+            st.pop_back();
+            if (!blocked[x]) continue;
+            blocked[x] = 0;
+            for (int w : B[x]) st.push_back(w);
+            B[x].clear();
         }
     }
-    return {};
-}
\ No newline at end of file
+
+    // Tìm mọi chu trình qua s trong tập có nhãn tag; dừng khi đủ limit
+    void fromStart(int s, int tag, int limit, vector<vector<int>>& out, int& found) {
+        auto allowed = [&](int w) { return member[w] == tag; };
+
+        struct Frame { int v; int next; bool f; };
+        vector<Frame> call{{s, 0, false}};
+        path.assign(1, s);
+        blocked[s] = 1;
+
+        while (!call.empty() && found < limit) {
+            Frame& fr = call.back();
+            const auto row = g.adj[fr.v];
+            if (fr.next < (int)row.size()) {
+                const int w = row[fr.next++];
+                if (!allowed(w)) continue;
+                if (w == s) {
+                    out.push_back(path);
+                    found++;
+                    fr.f = true;
+                } else if (!blocked[w]) {
+                    blocked[w] = 1;
+                    path.push_back(w);
+                    call.push_back({w, 0, false});
+                }
+                continue;
+            }
+            const int v = fr.v;
+            const bool f = fr.f;
+            if (f) {
+                unblock(v);
+            } else {
+                for (int w : row) {
+                    if (allowed(w) && find(B[w].begin(), B[w].end(), v) == B[w].end()) {
+                        B[w].push_back(v);
+                    }
+                }
+            }
+            call.pop_back();
+            path.pop_back();
+            if (!call.empty() && f) call.back().f = true;
+        }
+    }
+
+    void reset(const vector<int>& nodes) {
+        for (int u : nodes) {
+            blocked[u] = 0;
+            B[u].clear();
+        }
+    }
+};
+}
+
+// Johnson: với SCC S, lấy s = min(S), liệt kê chu trình qua s, rồi bỏ s và
+// tách lại SCC của phần còn lại. Mỗi SCC con có chu trình đều cho ít nhất một
+// chu trình, nên tổng chi phí ~ O(maxPerScc * (V + E)) mỗi SCC ban đầu.
+vector<vector<int>> enumerateCycles(const CourseGraph& g,
+                                    const SccDecomposition& scc,
+                                    int maxPerScc) {
+    vector<vector<int>> cycles;
+    if (maxPerScc <= 0) return cycles;
+    Johnson j(g);
+    Tarjan t(g);
+    int nextTag = 0;
+    for (const auto& comp : scc.cyclic) {
+        int found = 0;
+        vector<vector<int>> work{comp}; // mỗi phần tử đã sắp tăng dần theo idx
+        while (!work.empty() && found < maxPerScc) {
+            vector<int> S = move(work.back());
+            work.pop_back();
+            const int tag = nextTag++;
+            for (int u : S) j.member[u] = tag;
+
+            const int s = S.front();
+            j.fromStart(s, tag, maxPerScc, cycles, found);
+            j.reset(S);
+
+            j.member[s] = -1;
+            vector<int> rest(S.begin() + 1, S.end());
+            vector<vector<int>> subs;
+            t.run(rest, [&](int w) { return j.member[w] == tag; }, [&](vector<int> sub, bool hasCycle) {
+                if (!hasCycle) return;
+                sort(sub.begin(), sub.end());
+                subs.push_back(move(sub));
+            });
+            for (int u : rest) j.member[u] = -1;
+            // xử lý SCC con có node nhỏ nhất trước
+            sort(subs.begin(), subs.end(), [](const vector<int>& a, const vector<int>& b) {
+                return a.front() > b.front();
+            });
+            for (auto& sub : subs) work.push_back(move(sub));
+        }
+    }
+    return cycles;
+}
@@ -2,4 +2,22 @@
 #include <vector>
 #include "CourseGraph.h"
 
-std::vector<int> findOneCycle(const CourseGraph& g);
\ No newline at end of file
+std::vector<int> findOneCycle(const CourseGraph& g);
+
+// Phân rã thành phần liên thông mạnh (Tarjan, lặp không đệ quy, O(V+E)).
+// - count: tổng số SCC; compOf[u]: SCC chứa u
+// - cyclic: các SCC có chu trình (>= 2 node, hoặc 1 node có self-loop),
+//   mỗi SCC liệt kê node theo idx tăng dần
+struct SccDecomposition {
+    int count = 0;
+    std::vector<int> compOf;
+    std::vector<std::vector<int>> cyclic;
+};
+SccDecomposition findSccs(const CourseGraph& g);
+
+// Liệt kê chu trình sơ cấp (Johnson) trong từng SCC của scc.cyclic, tối đa
+// maxPerScc chu trình mỗi SCC. Mỗi chu trình là [v0, v1, ..., vk] với cạnh
+// v0 -> v1 -> ... -> vk -> v0; v0 là node có idx nhỏ nhất của chu trình.
+std::vector<std::vector<int>> enumerateCycles(const CourseGraph& g,
+                                              const SccDecomposition& scc,
+                                              int maxPerScc);
@@ -0,0 +1,65 @@
+#include "DominatorTree.h"
+#include "TopoSort.h"
+using namespace std;
+
+DominatorResult computeDominators(const CourseGraph& g) {
+    DominatorResult res;
+    TopoResult topo = topoSort(g);
+    if (!topo.success) return res;
+
+    const int V = g.V;
+    const int R = V; // gốc ảo
+    int LOG = 1;
+    while ((1 << LOG) <= V + 1) LOG++;
+    // up[k][u]: tổ tiên thứ 2^k của u trong cây dominator (gốc ảo tự trỏ về chính nó)
+    vector<vector<int>> up(LOG, vector<int>(V + 1, R));
+    vector<int> depth(V + 1, 0);
+
+    auto lca = [&](int a, int b) {
+        if (depth[a] < depth[b]) swap(a, b);
+        int diff = depth[a] - depth[b];
+        for (int k = 0; diff; k++, diff >>= 1) {
+            if (diff & 1) a = up[k][a];
+        }
+        if (a == b) return a;
+        for (int k = LOG - 1; k >= 0; k--) {
+            if (up[k][a] != up[k][b]) {
+                a = up[k][a];
+                b = up[k][b];
+            }
+        }
+        return up[0][a];
+    };
+
+    res.idom.assign(V, -1);
+    for (int u : topo.order) {
+        int d = R;
+        bool first = true;
+        for (int p : g.radj[u]) {
+            d = first ? p : lca(d, p);
+            first = false;
+            if (d == R) break;
+        }
+        res.idom[u] = d == R ? -1 : d;
+        depth[u] = depth[d] + 1;
+        up[0][u] = d;
+        for (int k = 1; k < LOG; k++) up[k][u] = up[k - 1][up[k - 1][u]];
+    }
+
+    // Cộng dồn kích thước cây con theo topo ngược (idom luôn đứng trước u)
+    res.dominatedCount.assign(V, 0);
+    for (int i = V - 1; i >= 0; i--) {
+        const int u = topo.order[i];
+        if (res.idom[u] != -1) res.dominatedCount[res.idom[u]] += res.dominatedCount[u] + 1;
+    }
+    depth.pop_back();
+    res.depth = move(depth);
+    res.success = true;
+    return res;
+}
+
+vector<int> dominatorsOf(const DominatorResult& dom, int u) {
+    vector<int> chain;
+    for (int d = dom.idom[u]; d != -1; d = dom.idom[d]) chain.push_back(d);
+    return chain;
+}
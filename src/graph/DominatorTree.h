@@ -0,0 +1,23 @@
+#pragma once
+#include <vector>
+#include "CourseGraph.h"
+
+// Cây dominator trên DAG prereq, gốc ảo R nối tới mọi nguồn (indeg = 0).
+// a dominate b nếu mọi đường từ R tới b đều đi qua a: a là "môn cổng" bắt buộc của b.
+// - idom[u]: dominator trực tiếp của u; -1 = gốc ảo (u không có môn cổng nào)
+// - dominatedCount[u]: số môn bị u dominate (không tính u)
+// - depth[u]: độ sâu trong cây (con trực tiếp của gốc ảo có depth 1)
+//
+// Duyệt theo topo một lần kiểu Cooper–Harvey–Kennedy: trên DAG mọi prereq đã có
+// idom trước khi tới u, và idom[u] = LCA (trong cây dominator) của các prereq.
+// LCA dùng binary lifting nên tổng công O((V + E) log V).
+struct DominatorResult {
+    bool success = false; // false nếu đồ thị có chu trình
+    std::vector<int> idom;
+    std::vector<int> dominatedCount;
+    std::vector<int> depth;
+};
+DominatorResult computeDominators(const CourseGraph& g);
+
+// Chuỗi dominator của u từ gần tới xa: idom[u], idom[idom[u]], ... (không gồm u, không gồm gốc ảo)
+std::vector<int> dominatorsOf(const DominatorResult& dom, int u);
@@ -0,0 +1,173 @@
+#include "FeedbackArcSet.h"
+#include "CycleDiagnosis.h"
+#include "IncrementalTopo.h"
+#include <algorithm>
+#include <utility>
+using namespace std;
+
+namespace {
+
+// Danh sách móc đôi theo khoá delta = outdeg - indeg (chỉ đếm cạnh trong SCC)
+struct DeltaBuckets {
+    int off;
+    vector<int> head, next, prev, key;
+    int maxKey; // chỉ số bucket cao nhất có thể khác rỗng
+
+    DeltaBuckets(int V, int maxDeg)
+        : off(maxDeg), head(2 * maxDeg + 1, -1), next(V, -1), prev(V, -1), key(V, 0), maxKey(-1) {}
+
+    void insert(int u, int delta) {
+        const int b = delta + off;
+        key[u] = b;
+        prev[u] = -1;
+        next[u] = head[b];
+        if (head[b] != -1) prev[head[b]] = u;
+        head[b] = u;
+        maxKey = max(maxKey, b);
+    }
+    void erase(int u) {
+        if (prev[u] != -1) next[prev[u]] = next[u];
+        else head[key[u]] = next[u];
+        if (next[u] != -1) prev[next[u]] = prev[u];
+    }
+    int peekMax() {
+        while (head[maxKey] == -1) maxKey--;
+        return head[maxKey];
+    }
+};
+
+} // namespace
+
+vector<FeedbackArc> findFeedbackArcSet(const CourseGraph& g) {
+    const int V = g.V;
+    SccDecomposition scc = findSccs(g);
+    if (scc.cyclic.empty()) return {};
+
+    // chỉ giữ node thuộc SCC có chu trình; cạnh trong = cùng SCC, không phải self-loop
+    vector<char> active(V, 0);
+    int remaining = 0;
+    for (const auto& comp : scc.cyclic) {
+        for (int u : comp) { active[u] = 1; remaining++; }
+    }
+    auto inner = [&](int u, int v) { return u != v && scc.compOf[u] == scc.compOf[v]; };
+
+    vector<int> outd(V, 0), ind(V, 0);
+    int maxDeg = 0;
+    for (int u = 0; u < V; u++) {
+        if (!active[u]) continue;
+        for (int v : g.adj[u]) {
+            if (inner(u, v)) { outd[u]++; ind[v]++; }
+        }
+    }
+    for (int u = 0; u < V; u++) maxDeg = max(maxDeg, max(outd[u], ind[u]));
+
+    DeltaBuckets buckets(V, maxDeg);
+    vector<int> sinks, sources;
+    for (int u = 0; u < V; u++) {
+        if (!active[u]) continue;
+        buckets.insert(u, outd[u] - ind[u]);
+        if (outd[u] == 0) sinks.push_back(u);
+        else if (ind[u] == 0) sources.push_back(u);
+    }
+
+    // Bỏ u khỏi đồ thị còn lại, cập nhật bậc và bucket của hàng xóm
+    auto removeNode = [&](int u) {
+        active[u] = 0;
+        remaining--;
+        buckets.erase(u);
+        for (int v : g.adj[u]) {
+            if (!active[v] || !inner(u, v)) continue;
+            buckets.erase(v);
+            buckets.insert(v, outd[v] - --ind[v]);
+            if (ind[v] == 0) sources.push_back(v);
+        }
+        for (int w : g.radj[u]) {
+            if (!active[w] || !inner(w, u)) continue;
+            buckets.erase(w);
+            buckets.insert(w, --outd[w] - ind[w]);
+            if (outd[w] == 0) sinks.push_back(w);
+        }
+    };
+
+    vector<int> s1, s2;
+    while (remaining > 0) {
+        bool progressed = true;
+        while (progressed) {
+            progressed = false;
+            while (!sinks.empty()) {
+                const int u = sinks.back();
+                sinks.pop_back();
+                if (!active[u] || outd[u] != 0) continue;
+                removeNode(u);
+                s2.push_back(u);
+                progressed = true;
+            }
+            while (!sources.empty()) {
+                const int u = sources.back();
+                sources.pop_back();
+                if (!active[u] || ind[u] != 0) continue;
+                removeNode(u);
+                s1.push_back(u);
+                progressed = true;
+            }
+        }
+        if (remaining == 0) break;
+        const int u = buckets.peekMax();
+        removeNode(u);
+        s1.push_back(u);
+    }
+    s1.insert(s1.end(), s2.rbegin(), s2.rend());
+
+    vector<int> pos(V, -1);
+    for (int i = 0; i < (int)s1.size(); i++) pos[s1[i]] = i;
+
+    // Cạnh ngược thứ tự (kể cả self-loop) -> ứng viên; phần còn lại là DAG
+    vector<FeedbackArc> candidates;
+    for (int u = 0; u < V; u++) {
+        if (pos[u] == -1) continue;
+        for (int v : g.adj[u]) {
+            if (scc.compOf[u] == scc.compOf[v] && pos[u] >= pos[v]) candidates.push_back({u, v});
+        }
+    }
+
+    // Thêm lại cạnh nào không tạo chu trình
+    CourseGraph dag = g;
+    removeArcs(dag, candidates);
+    IncrementalTopo inc(dag);
+    vector<FeedbackArc> res;
+    for (const auto& a : candidates) {
+        if (!inc.addEdge(a.prereq, a.course)) res.push_back(a);
+    }
+    return res;
+}
+
+void removeArcs(CourseGraph& g, const vector<FeedbackArc>& arcs) {
+    const int V = g.V;
+    // arcs gom theo prereq: drop[off[u] .. off[u+1]) là các course cần bỏ của u
+    vector<int> src, dst;
+    for (const auto& a : arcs) { src.push_back(a.prereq); dst.push_back(a.course); }
+    CsrAdjacency drop;
+    drop.assign(V, src, dst);
+    vector<int> pending(drop.target);
+
+    vector<int> from, to;
+    from.reserve(g.E);
+    to.reserve(g.E);
+    for (int u = 0; u < V; u++) {
+        int* first = pending.data() + drop.offset[u];
+        int* last = pending.data() + drop.offset[u + 1];
+        for (int v : g.adj[u]) {
+            int* hit = find(first, last, v);
+            if (hit != last) {
+                *hit = -1; // mỗi phần tử arcs chỉ bỏ một cạnh
+                continue;
+            }
+            from.push_back(u);
+            to.push_back(v);
+        }
+    }
+    g.E = (int)from.size();
+    g.adj.assign(V, from, to);
+    g.radj.assign(V, to, from);
+    for (int u = 0; u < V; u++) g.indeg[u] = g.radj.degree(u);
+}
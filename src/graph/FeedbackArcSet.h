@@ -0,0 +1,22 @@
+#pragma once
+#include <vector>
+#include "CourseGraph.h"
+
+// Cạnh prereq -> course đề xuất bỏ để phá chu trình
+struct FeedbackArc {
+    int prereq;
+    int course;
+};
+
+// Tập cạnh phản hồi gần tối thiểu: bỏ hết các cạnh này thì g thành DAG.
+// - Chỉ xét cạnh bên trong SCC có chu trình (cạnh giữa hai SCC không nằm trên chu trình nào).
+// - Eades–Lin–Smyth O(V + E): bóc sink về cuối, source về đầu, còn lại lấy node có
+//   outdeg - indeg lớn nhất; cạnh đi ngược thứ tự thu được là cạnh phản hồi.
+// - Sau đó thử thêm lại từng cạnh (IncrementalTopo): cạnh nào không tạo chu trình
+//   thì không cần bỏ, nên kết quả tối thiểu theo nghĩa bao hàm.
+// Rỗng nếu g đã là DAG. Thứ tự ổn định theo (prereq, vị trí trong g.adj).
+std::vector<FeedbackArc> findFeedbackArcSet(const CourseGraph& g);
+
+// Bỏ tại chỗ mỗi cạnh trong arcs (mỗi phần tử bỏ đúng một bản nếu cạnh bị lặp),
+// dựng lại adj/radj/indeg/E. Cạnh không có trong g bị bỏ qua.
+void removeArcs(CourseGraph& g, const std::vector<FeedbackArc>& arcs);
@@ -0,0 +1,226 @@
+#include "IncrementalTopo.h"
+#include "TopoSort.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+using namespace std;
+
+IncrementalTopo::IncrementalTopo(const CourseGraph& g) {
+    TopoResult topo = topoSort(g);
+    if (!topo.success) {
+        throw runtime_error("IncrementalTopo: graph has cycle (topo failed)");
+    }
+    const int V = g.V;
+    out_.assign(V, {});
+    in_.assign(V, {});
+    for (int u = 0; u < V; u++) {
+        out_[u].assign(g.adj[u].begin(), g.adj[u].end());
+        in_[u].assign(g.radj[u].begin(), g.radj[u].end());
+    }
+    nodeAt_ = topo.order;
+    ord_.assign(V, 0);
+    for (int i = 0; i < V; i++) ord_[nodeAt_[i]] = i;
+
+    offered_.assign(V, 0);
+    for (int u = 0; u < V; u++) offered_[u] = g.offered(u);
+    term_.assign(V, 1);
+    for (int u : nodeAt_) term_[u] = termFromPreds(u);
+    alive_.assign(V, 1);
+    mark_.assign(V, 0);
+    idxToId_ = g.idxToId;
+    idToIdx_.reserve(V);
+    for (int u = 0; u < V; u++) idToIdx_.emplace(idxToId_[u], u);
+}
+
+void IncrementalTopo::checkNode(int u, const char* op) const {
+    if (!alive(u)) {
+        throw runtime_error(string("IncrementalTopo::") + op + ": invalid course index " + to_string(u));
+    }
+}
+
+int IncrementalTopo::indexOf(const string& id) const {
+    auto it = idToIdx_.find(id);
+    return it == idToIdx_.end() ? -1 : it->second;
+}
+
+vector<int> IncrementalTopo::order() const {
+    vector<int> res;
+    res.reserve(nodeAt_.size());
+    for (int u : nodeAt_) {
+        if (alive_[u]) res.push_back(u);
+    }
+    return res;
+}
+
+// DFS xuôi từ start, chỉ qua node có vị trí < upper; true nếu chạm target (chu trình)
+bool IncrementalTopo::forwardReach(int start, int target, int upper, vector<int>& deltaF) {
+    vector<int> st{start};
+    mark_[start] = 1;
+    deltaF.push_back(start);
+    while (!st.empty()) {
+        int n = st.back();
+        st.pop_back();
+        for (int w : out_[n]) {
+            if (w == target) {
+                for (int x : deltaF) mark_[x] = 0;
+                return true;
+            }
+            if (!mark_[w] && ord_[w] < upper) {
+                mark_[w] = 1;
+                deltaF.push_back(w);
+                st.push_back(w);
+            }
+        }
+    }
+    return false;
+}
+
+// DFS ngược từ start, chỉ qua node có vị trí > lower
+void IncrementalTopo::backwardCollect(int start, int lower, vector<int>& deltaB) {
+    vector<int> st{start};
+    mark_[start] = 1;
+    deltaB.push_back(start);
+    while (!st.empty()) {
+        int n = st.back();
+        st.pop_back();
+        for (int w : in_[n]) {
+            if (!mark_[w] && ord_[w] > lower) {
+                mark_[w] = 1;
+                deltaB.push_back(w);
+                st.push_back(w);
+            }
+        }
+    }
+}
+
+// Dồn deltaB lên trước deltaF, tái dùng đúng tập vị trí mà hai nhóm đang chiếm
+void IncrementalTopo::reorder(vector<int>& deltaB, vector<int>& deltaF) {
+    auto byOrd = [&](int a, int b) { return ord_[a] < ord_[b]; };
+    sort(deltaB.begin(), deltaB.end(), byOrd);
+    sort(deltaF.begin(), deltaF.end(), byOrd);
+
+    vector<int> nodes;
+    nodes.reserve(deltaB.size() + deltaF.size());
+    nodes.insert(nodes.end(), deltaB.begin(), deltaB.end());
+    nodes.insert(nodes.end(), deltaF.begin(), deltaF.end());
+
+    vector<int> slots;
+    slots.reserve(nodes.size());
+    for (int n : nodes) slots.push_back(ord_[n]);
+    sort(slots.begin(), slots.end());
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ord_[nodes[i]] = slots[i];
+        nodeAt_[slots[i]] = nodes[i];
+        mark_[nodes[i]] = 0;
+    }
+}
+
+bool IncrementalTopo::addEdge(int from, int to) {
+    checkNode(from, "addEdge");
+    checkNode(to, "addEdge");
+    if (from == to) return false;
+
+    const int lb = ord_[to], ub = ord_[from];
+    if (lb < ub) {
+        // vùng ảnh hưởng: các node có vị trí trong [lb, ub]
+        vector<int> deltaF, deltaB;
+        if (forwardReach(to, from, ub, deltaF)) return false;
+        backwardCollect(from, lb, deltaB);
+        reorder(deltaB, deltaF);
+    }
+    out_[from].push_back(to);
+    in_[to].push_back(from);
+    repairTerms({to});
+    return true;
+}
+
+bool IncrementalTopo::removeEdge(int from, int to) {
+    checkNode(from, "removeEdge");
+    checkNode(to, "removeEdge");
+    auto& outs = out_[from];
+    auto it = find(outs.begin(), outs.end(), to);
+    if (it == outs.end()) return false;
+    outs.erase(it);
+    auto& ins = in_[to];
+    ins.erase(find(ins.begin(), ins.end(), from));
+    repairTerms({to});
+    return true;
+}
+
+int IncrementalTopo::addCourse(const string& id, uint64_t offeredMask) {
+    if (id.empty()) {
+        throw runtime_error("IncrementalTopo::addCourse: empty id");
+    }
+    if (idToIdx_.count(id)) {
+        throw runtime_error("IncrementalTopo::addCourse: duplicate id: " + id);
+    }
+    const int u = (int)alive_.size();
+    out_.emplace_back();
+    in_.emplace_back();
+    ord_.push_back((int)nodeAt_.size());
+    nodeAt_.push_back(u);
+    offered_.push_back(offeredMask);
+    term_.push_back(0);
+    alive_.push_back(1);
+    mark_.push_back(0);
+    idToIdx_.emplace(id, u);
+    idxToId_.push_back(id);
+    term_[u] = termFromPreds(u);
+    return u;
+}
+
+void IncrementalTopo::removeCourse(int u) {
+    checkNode(u, "removeCourse");
+    vector<int> seeds = out_[u];
+    for (int s : out_[u]) {
+        auto& ins = in_[s];
+        ins.erase(find(ins.begin(), ins.end(), u));
+    }
+    for (int p : in_[u]) {
+        auto& outs = out_[p];
+        outs.erase(find(outs.begin(), outs.end(), u));
+    }
+    out_[u].clear();
+    in_[u].clear();
+    alive_[u] = 0;
+    term_[u] = 0;
+    idToIdx_.erase(idxToId_[u]);
+    repairTerms(seeds);
+}
+
+// max(term prereq) + 1, đẩy tới kỳ mở gần nhất (giống computeEarliestTerms)
+int IncrementalTopo::termFromPreds(int u) const {
+    int t = 1;
+    for (int p : in_[u]) t = max(t, term_[p] + 1);
+    const int offered = nextOfferedTerm(offered_[u], t);
+    return offered ? offered : t;
+}
+
+// Tính lại term theo vị trí tăng dần; chỉ lan sang successor khi term thật sự đổi
+void IncrementalTopo::repairTerms(const vector<int>& seeds) {
+    using Item = pair<int, int>; // (vị trí, node)
+    priority_queue<Item, vector<Item>, greater<Item>> pq;
+    for (int s : seeds) {
+        if (alive_[s] && !mark_[s]) {
+            mark_[s] = 1;
+            pq.emplace(ord_[s], s);
+        }
+    }
+    while (!pq.empty()) {
+        int n = pq.top().second;
+        pq.pop();
+        mark_[n] = 0;
+        const int t = termFromPreds(n);
+        if (t == term_[n]) continue;
+        term_[n] = t;
+        for (int s : out_[n]) {
+            if (!mark_[s]) {
+                mark_[s] = 1;
+                pq.emplace(ord_[s], s);
+            }
+        }
+    }
+}
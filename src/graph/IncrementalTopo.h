@@ -0,0 +1,64 @@
+/*
+ * IncrementalTopo
+ * Duy trì thứ tự topo + earliest term khi sửa prereq trực tiếp (Pearce–Kelly),
+ * không cần build lại CourseGraph / topoSort / computeEarliestTerms.
+ *
+ * - addEdge(v, u): thêm prereq v -> u. Nếu tạo chu trình thì trả false và
+ *   không đổi gì; chỉ duyệt các node có vị trí nằm giữa ord[u] .. ord[v].
+ * - removeEdge(v, u): bỏ một cạnh v -> u (thứ tự cũ vẫn hợp lệ).
+ * - addCourse(id, mask): thêm node cô lập ở cuối thứ tự, trả về idx mới.
+ * - removeCourse(u): bỏ mọi cạnh của u và đánh dấu u đã xoá (idx không dồn lại).
+ *
+ * Sau mỗi thao tác, termByIdx chỉ được sửa trên vùng bị ảnh hưởng
+ * (hậu duệ của node có term thay đổi), duyệt theo thứ tự topo.
+ * Term áp offeredMask như computeEarliestTerms: max(term prereq) + 1 rồi nhảy
+ * tới kỳ mở gần nhất (nextOfferedTerm); không còn kỳ mở thì giữ kỳ theo prereq.
+ */
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CourseGraph.h"
+
+class IncrementalTopo {
+public:
+    // Ném std::runtime_error nếu g có chu trình
+    explicit IncrementalTopo(const CourseGraph& g);
+
+    bool addEdge(int from, int to);
+    bool removeEdge(int from, int to);
+    int addCourse(const std::string& id, std::uint64_t offeredMask = 0); // 0 = mở mọi kỳ
+    void removeCourse(int u);
+
+    int indexOf(const std::string& id) const; // -1 nếu không có
+    bool alive(int u) const { return u >= 0 && u < (int)alive_.size() && alive_[u]; }
+    int capacity() const { return (int)alive_.size(); } // số idx đã cấp (kể cả đã xoá)
+
+    std::vector<int> order() const;                           // các node còn sống theo thứ tự topo
+    int position(int u) const { return ord_[u]; }             // vị trí của u trong thứ tự
+    const std::vector<int>& termByIdx() const { return term_; } // 1-based; node đã xoá giữ 0
+    const std::vector<int>& successors(int u) const { return out_[u]; }
+    const std::vector<int>& predecessors(int u) const { return in_[u]; }
+    const std::string& idOf(int u) const { return idxToId_[u]; }
+    std::uint64_t offered(int u) const { return offered_[u]; }
+
+private:
+    void checkNode(int u, const char* op) const;
+    bool forwardReach(int start, int target, int upper, std::vector<int>& deltaF);
+    void backwardCollect(int start, int lower, std::vector<int>& deltaB);
+    void reorder(std::vector<int>& deltaB, std::vector<int>& deltaF);
+    void repairTerms(const std::vector<int>& seeds);
+    int termFromPreds(int u) const;
+
+    std::vector<std::vector<int>> out_; // v -> u
+    std::vector<std::vector<int>> in_;  // u <- v
+    std::vector<int> ord_;              // node -> vị trí
+    std::vector<int> nodeAt_;           // vị trí -> node
+    std::vector<int> term_;
+    std::vector<std::uint64_t> offered_; // như CourseGraph::offeredMask, đủ V phần tử
+    std::vector<char> alive_;
+    std::vector<char> mark_;            // cờ tạm cho DFS / hàng đợi sửa term
+    std::unordered_map<std::string, int> idToIdx_;
+    std::vector<std::string> idxToId_;
+};
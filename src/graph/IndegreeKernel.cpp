@@ -0,0 +1,11 @@
+#include "IndegreeKernel.h"
+
+int decrementReady(int* indeg, const int* first, const int* last, int* out) {
+    int k = 0;
+    for (const int* p = first; p != last; ++p) {
+        const int v = *p;
+        out[k] = v;
+        k += (--indeg[v] == 0);
+    }
+    return k;
+}
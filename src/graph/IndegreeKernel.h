@@ -0,0 +1,16 @@
+/*
+ * IndegreeKernel
+ * Kernel bên trong vòng Kahn: với một hàng CSR [first, last) của đỉnh vừa lấy
+ * ra, giảm indeg[v] cho mọi v và ghi các v vừa về 0 vào out, đúng thứ tự của
+ * vòng `if (--indeg[v] == 0) push(v)`, nhưng không rẽ nhánh
+ * (out[k] = v; k += --indeg[v] == 0).
+ *
+ * Bản SSE4.1 / AVX2 (gather + cmpeq + movemask) đã được đo bằng topo_bench và
+ * bỏ đi: x86 không có scatter nên phải quét mỗi hàng hai lượt, chậm hơn bản
+ * này trên mọi DAG ngẫu nhiên dày đã thử (AVX2 x0.78..x0.90, SSE4.1 x0.77..x0.92).
+ * Số phần tử ghi ra <= độ dài hàng, nên out có thể là đuôi hàng đợi Kahn cỡ V.
+ */
+#pragma once
+
+// Trả về số đỉnh ghi vào out
+int decrementReady(int* indeg, const int* first, const int* last, int* out);
@@ -0,0 +1,108 @@
+#include "ReachCounts.h"
+#include "TopoSort.h"
+#include "util/Bits.h"
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+namespace {
+
+constexpr int kHllBits = 7;
+constexpr int kHllRegs = 1 << kHllBits;
+
+uint64_t mix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Đếm chính xác theo khối cột [lo, hi); dir = adj (hậu duệ) hoặc radj (tổ tiên),
+// order phải là thứ tự mà mọi node trong dir[u] đã xong trước u.
+void exactCounts(const CourseGraph& g, const CsrAdjacency& dir, const vector<int>& order,
+                 int W, vector<uint64_t>& bits, vector<int>& out) {
+    const int V = g.V;
+    for (int lo = 0; lo < V; lo += W * 64) {
+        const int hi = min(V, lo + W * 64);
+        const int words = (hi - lo + 63) / 64;
+        fill(bits.begin(), bits.begin() + (size_t)V * words, 0);
+        for (int u : order) {
+            uint64_t* row = &bits[(size_t)u * words];
+            for (int v : dir[u]) {
+                const uint64_t* src = &bits[(size_t)v * words];
+                for (int w = 0; w < words; w++) row[w] |= src[w];
+                if (v >= lo && v < hi) row[(v - lo) >> 6] |= uint64_t(1) << ((v - lo) & 63);
+            }
+            int c = 0;
+            for (int w = 0; w < words; w++) c += popCount(row[w]);
+            out[u] += c;
+        }
+    }
+}
+
+int hllEstimate(const uint8_t* reg) {
+    double sum = 0;
+    int zeros = 0;
+    for (int i = 0; i < kHllRegs; i++) {
+        sum += ldexp(1.0, -reg[i]);
+        if (reg[i] == 0) zeros++;
+    }
+    const double m = kHllRegs;
+    double est = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+    if (est <= 2.5 * m && zeros > 0) est = m * log(m / zeros); // linear counting cho tập nhỏ
+    return (int)llround(est);
+}
+
+void hllCounts(const CourseGraph& g, const CsrAdjacency& dir, const vector<int>& order, vector<int>& out) {
+    const int V = g.V;
+    vector<uint8_t> reg((size_t)V * kHllRegs, 0);
+    for (int u : order) {
+        uint8_t* row = &reg[(size_t)u * kHllRegs];
+        for (int v : dir[u]) {
+            const uint8_t* src = &reg[(size_t)v * kHllRegs];
+            for (int i = 0; i < kHllRegs; i++) row[i] = max(row[i], src[i]);
+            const uint64_t h = mix64((uint64_t)v);
+            const int idx = (int)(h >> (64 - kHllBits));
+            const uint64_t rest = h << kHllBits;
+            const uint8_t rank = rest ? (uint8_t)(64 - highestBit(rest)) : (uint8_t)(64 - kHllBits + 1);
+            row[idx] = max(row[idx], rank);
+        }
+        out[u] = min(V - 1, hllEstimate(row));
+    }
+}
+
+} // namespace
+
+ReachCounts computeReachCounts(const CourseGraph& g, size_t maxBitsetBytes, uint64_t maxExactWordOps) {
+    ReachCounts res;
+    TopoResult topo = topoSort(g);
+    if (!topo.success) return res;
+
+    const int V = g.V;
+    vector<int> reverseOrder(topo.order.rbegin(), topo.order.rend());
+    res.success = true;
+    res.descendants.assign(V, 0);
+    res.ancestors.assign(V, 0);
+
+    const uint64_t totalWords = (uint64_t)(V + 63) / 64;
+    if (totalWords * (uint64_t)(V + g.E) > maxExactWordOps) {
+        res.exact = false;
+        hllCounts(g, g.adj, reverseOrder, res.descendants);
+        hllCounts(g, g.radj, topo.order, res.ancestors);
+        return res;
+    }
+
+    // số word mỗi hàng trong một khối, sao cho V * W * 8 <= maxBitsetBytes
+    const size_t fit = maxBitsetBytes / (sizeof(uint64_t) * (size_t)max(V, 1));
+    const int W = (int)max<size_t>(1, min<size_t>(fit, totalWords));
+    vector<uint64_t> bits((size_t)V * W);
+    exactCounts(g, g.adj, reverseOrder, W, bits, res.descendants);
+    exactCounts(g, g.radj, topo.order, W, bits, res.ancestors);
+    return res;
+}
+
+vector<int64_t> topoKeyImpact(const ReachCounts& rc) {
+    vector<int64_t> key(rc.descendants.size());
+    for (size_t u = 0; u < key.size(); u++) key[u] = -(int64_t)rc.descendants[u];
+    return key;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CourseGraph.h"
+
+// Số hậu duệ / tổ tiên bắc cầu của mỗi môn ("rớt môn này chặn bao nhiêu môn").
+// - Chính xác: DP bitset theo topo, mỗi lần một khối cột 64 bit/word
+//   (bộ nhớ <= maxBitsetBytes), tổng công ~ ceil(V/64) * (V + E) phép OR.
+// - Khi công đó vượt maxExactWordOps: ước lượng HyperLogLog (128 thanh ghi
+//   mỗi node, hợp = max từng byte), sai số chuẩn ~9%; exact = false.
+struct ReachCounts {
+    bool success = false; // false nếu đồ thị có chu trình
+    bool exact = true;
+    std::vector<int> descendants; // không tính chính nó
+    std::vector<int> ancestors;
+};
+ReachCounts computeReachCounts(const CourseGraph& g,
+                               std::size_t maxBitsetBytes = std::size_t(64) << 20,
+                               std::uint64_t maxExactWordOps = std::uint64_t(1) << 32);
+
+// Key cho topoSortByKey: môn mở khoá nhiều môn phía sau ra trước
+std::vector<std::int64_t> topoKeyImpact(const ReachCounts& rc);
@@ -0,0 +1,160 @@
+#include "ReachabilityIndex.h"
+#include "TopoSort.h"
+#include "util/Bits.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+using namespace std;
+
+size_t ReachabilityIndex::bitsetBytes(int V) {
+    return (size_t)V * (size_t)((V + 63) / 64) * sizeof(uint64_t);
+}
+
+ReachabilityIndex::ReachabilityIndex(const CourseGraph& g, Kind kind) : V_(g.V) {
+    TopoResult topo = topoSort(g);
+    if (!topo.success) {
+        throw runtime_error("ReachabilityIndex: graph has cycle (topo failed)");
+    }
+    if (kind == Kind::Bitset) {
+        buildBitset(g, topo.order);
+        return;
+    }
+    const size_t budget = kind == Kind::Auto ? bitsetBytes(V_) : numeric_limits<size_t>::max();
+    if (!buildIntervals(g, topo.order, budget)) {
+        buildBitset(g, topo.order);
+    }
+}
+
+// Trả false (và bỏ dở) nếu tổng bộ nhớ khoảng vượt budget
+bool ReachabilityIndex::buildIntervals(const CourseGraph& g, const vector<int>& order, size_t budget) {
+    kind_ = Kind::Interval;
+    const int V = V_;
+
+    // 1) Post-order trên rừng DFS xuất phát từ các nguồn (lặp, không đệ quy)
+    post_.assign(V, -1);
+    nodeAtPost_.assign(V, 0);
+    vector<int> low(V, 0);
+    vector<pair<int, int>> st;
+    int counter = 0;
+    for (int root : order) {
+        if (post_[root] != -1) continue;
+        post_[root] = -2; // đang thăm
+        low[root] = counter;
+        st.emplace_back(root, 0);
+        while (!st.empty()) {
+            const int u = st.back().first;
+            const auto row = g.adj[u];
+            if (st.back().second < (int)row.size()) {
+                const int v = row[st.back().second++];
+                if (post_[v] == -1) {
+                    post_[v] = -2;
+                    low[v] = counter;
+                    st.emplace_back(v, 0);
+                }
+                continue;
+            }
+            post_[u] = counter;
+            nodeAtPost_[counter] = u;
+            counter++;
+            st.pop_back();
+        }
+    }
+
+    // 2) Theo topo ngược: khoảng(u) = [low(u), post(u)] ∪ khoảng(các successor), gộp lại
+    ivBegin_.assign(V, 0);
+    ivEnd_.assign(V, 0);
+    ivLo_.clear();
+    ivHi_.clear();
+    vector<pair<int, int>> buf;
+    for (int i = V - 1; i >= 0; i--) {
+        const int u = order[i];
+        buf.clear();
+        buf.emplace_back(low[u], post_[u]);
+        for (int v : g.adj[u]) {
+            for (int k = ivBegin_[v]; k < ivEnd_[v]; k++) buf.emplace_back(ivLo_[k], ivHi_[k]);
+        }
+        sort(buf.begin(), buf.end());
+        ivBegin_[u] = (int)ivLo_.size();
+        for (const auto& iv : buf) {
+            if (ivLo_.size() > (size_t)ivBegin_[u] && iv.first <= ivHi_.back() + 1) {
+                ivHi_.back() = max(ivHi_.back(), iv.second);
+            } else {
+                ivLo_.push_back(iv.first);
+                ivHi_.push_back(iv.second);
+            }
+        }
+        ivEnd_[u] = (int)ivLo_.size();
+        if (memoryBytes() > budget) {
+            post_.clear(); nodeAtPost_.clear();
+            ivBegin_.clear(); ivEnd_.clear(); ivLo_.clear(); ivHi_.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ReachabilityIndex::buildBitset(const CourseGraph& g, const vector<int>& order) {
+    kind_ = Kind::Bitset;
+    words_ = (V_ + 63) / 64;
+    bits_.assign((size_t)V_ * words_, 0);
+    for (int i = V_ - 1; i >= 0; i--) {
+        const int u = order[i];
+        uint64_t* row = &bits_[(size_t)u * words_];
+        for (int v : g.adj[u]) {
+            const uint64_t* src = &bits_[(size_t)v * words_];
+            for (int w = 0; w < words_; w++) row[w] |= src[w];
+            row[v >> 6] |= uint64_t(1) << (v & 63);
+        }
+    }
+}
+
+bool ReachabilityIndex::reaches(int from, int to) const {
+    if (from == to) return false; // DAG: không tự đạt chính nó
+    if (kind_ == Kind::Bitset) {
+        return bits_[(size_t)from * words_ + (to >> 6)] >> (to & 63) & 1;
+    }
+    const int p = post_[to];
+    // khoảng cuối cùng có lo <= p
+    auto first = ivLo_.begin() + ivBegin_[from], last = ivLo_.begin() + ivEnd_[from];
+    auto it = upper_bound(first, last, p);
+    if (it == first) return false;
+    return p <= ivHi_[(it - ivLo_.begin()) - 1];
+}
+
+vector<int> ReachabilityIndex::descendants(int u) const {
+    vector<int> out;
+    if (kind_ == Kind::Bitset) {
+        const uint64_t* row = &bits_[(size_t)u * words_];
+        for (int w = 0; w < words_; w++) {
+            for (uint64_t x = row[w]; x; x &= x - 1) {
+                out.push_back(w * 64 + lowestBit(x));
+            }
+        }
+        return out;
+    }
+    for (int k = ivBegin_[u]; k < ivEnd_[u]; k++) {
+        for (int p = ivLo_[k]; p <= ivHi_[k]; p++) {
+            if (nodeAtPost_[p] != u) out.push_back(nodeAtPost_[p]);
+        }
+    }
+    sort(out.begin(), out.end());
+    return out;
+}
+
+int ReachabilityIndex::countDescendants(int u) const {
+    int n = 0;
+    if (kind_ == Kind::Bitset) {
+        const uint64_t* row = &bits_[(size_t)u * words_];
+        for (int w = 0; w < words_; w++) n += popCount(row[w]);
+        return n;
+    }
+    for (int k = ivBegin_[u]; k < ivEnd_[u]; k++) n += ivHi_[k] - ivLo_[k] + 1;
+    return n - 1; // bỏ chính u
+}
+
+size_t ReachabilityIndex::memoryBytes() const {
+    if (kind_ == Kind::Bitset) return bits_.size() * sizeof(uint64_t);
+    return (post_.size() + nodeAtPost_.size() + ivBegin_.size() + ivEnd_.size() +
+            ivLo_.size() + ivHi_.size()) * sizeof(int);
+}
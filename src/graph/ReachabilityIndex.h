@@ -0,0 +1,52 @@
+/*
+ * ReachabilityIndex
+ * Chỉ mục dựng một lần cho mỗi snapshot curriculum, trả lời nhanh:
+ * - reaches(a, b): a có là prereq bắc cầu của b không ("A dẫn tới B?")
+ * - descendants(a): các môn bị chặn nếu rớt a
+ *
+ * Hai kiểu chỉ mục:
+ * - Interval: đánh số post-order trên rừng DFS, mỗi node giữ danh sách khoảng
+ *   post-order đã gộp phủ đúng tập đạt được (Agrawal–Borgida–Jagadish).
+ *   Truy vấn = tìm nhị phân trên vài khoảng; bộ nhớ ~ tổng số khoảng.
+ * - Bitset: bao đóng bắc cầu đầy đủ, truy vấn O(1), bộ nhớ V*V/8 byte.
+ * - Auto: dựng Interval, chuyển sang Bitset nếu Interval tốn bộ nhớ hơn.
+ *
+ * Ném std::runtime_error nếu đồ thị có chu trình.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CourseGraph.h"
+
+class ReachabilityIndex {
+public:
+    enum class Kind { Auto, Interval, Bitset };
+
+    explicit ReachabilityIndex(const CourseGraph& g, Kind kind = Kind::Auto);
+
+    Kind kind() const { return kind_; }
+    bool reaches(int from, int to) const;    // from != to và có đường from -> ... -> to
+    std::vector<int> descendants(int u) const; // theo idx tăng dần
+    int countDescendants(int u) const;
+    std::size_t memoryBytes() const;
+
+    static std::size_t bitsetBytes(int V);
+
+private:
+    bool buildIntervals(const CourseGraph& g, const std::vector<int>& order, std::size_t budget);
+    void buildBitset(const CourseGraph& g, const std::vector<int>& order);
+
+    Kind kind_ = Kind::Interval;
+    int V_ = 0;
+
+    // Interval
+    std::vector<int> post_;        // idx -> số post-order
+    std::vector<int> nodeAtPost_;  // post-order -> idx
+    std::vector<int> ivBegin_, ivEnd_;      // khoảng của u: [ivBegin_[u], ivEnd_[u]) trong ivLo_/ivHi_
+    std::vector<int> ivLo_, ivHi_;          // khoảng đóng [lo, hi] theo post-order
+
+    // Bitset
+    int words_ = 0;
+    std::vector<std::uint64_t> bits_;       // hàng u: bits_[u * words_ ..]
+};
@@ -0,0 +1,20 @@
+#include "SmallGraph.h"
+using namespace std;
+
+namespace {
+template <int N>
+bool run(const CourseGraph& g, TopoResult& topo, vector<int>& earliest, bool* termsOk) {
+    SmallGraph<N> sg;
+    sg.assign(g);
+    const bool ok = sg.analyze(topo, earliest);
+    if (termsOk) *termsOk = ok;
+    return true;
+}
+}
+
+bool analyzeSmall(const CourseGraph& g, TopoResult& topo, vector<int>& earliest, bool* termsOk) {
+    if (g.V <= 64) return run<64>(g, topo, earliest, termsOk);
+    if (g.V <= 128) return run<128>(g, topo, earliest, termsOk);
+    if (g.V <= 256) return run<256>(g, topo, earliest, termsOk);
+    return false;
+}
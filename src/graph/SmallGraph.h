@@ -0,0 +1,115 @@
+/*
+ * SmallGraph<N>
+ * Đồ thị dung lượng cố định lúc biên dịch (N = 64 / 128 / 256 node), mỗi hàng
+ * kề là một std::bitset<N>, toàn bộ nằm trên stack, không cấp phát heap.
+ * Dành cho request tương tác với curriculum nhỏ (vd các mẫu trong thư mục data).
+ *
+ * analyze(): Kahn theo tầng bằng phép bit. Node u sẵn sàng khi
+ * (pre[u] & ~done).none(); ứng viên tầng sau chỉ là OR các succ của tầng hiện
+ * tại. Không có offeredMask thì tầng k (0-based) chính là earliest term k+1;
+ * có mask thì mỗi node lúc ra khỏi tầng kéo max(earliest prereq) + 1 rồi nhảy
+ * tới kỳ mở (nextOfferedTerm), giống computeEarliestTerms. Topo, earliest term
+ * và kiểm tra chu trình xong trong một lượt. Thứ tự ra giống topoSortParallel
+ * (theo tầng, trong tầng theo idx).
+ *
+ * analyzeSmall(): tự chọn N nhỏ nhất chứa được g.V; trả false nếu g.V > 256.
+ * termsOk (nếu có) = false khi có môn không còn kỳ mở.
+ */
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+#include "CourseGraph.h"
+#include "TopoSort.h"
+
+template <int N>
+struct SmallGraph {
+    static constexpr int kCapacity = N;
+
+    int V = 0;
+    std::array<std::bitset<N>, N> pre{};  // pre[u]: các prereq của u
+    std::array<std::bitset<N>, N> succ{}; // succ[v]: các môn cần v
+    std::array<std::uint64_t, N> mask{};  // offeredMask (0 = mở mọi kỳ)
+    bool masked = false;                  // có ít nhất một mask khác 0
+
+    // false nếu g.V > N
+    bool assign(const CourseGraph& g) {
+        if (g.V > N) return false;
+        V = g.V;
+        masked = false;
+        for (int u = 0; u < V; ++u) {
+            pre[u].reset();
+            succ[u].reset();
+            mask[u] = g.offered(u);
+            masked |= mask[u] != 0;
+        }
+        for (int v = 0; v < V; ++v) {
+            for (int u : g.adj[v]) {
+                succ[v].set(u);
+                pre[u].set(v);
+            }
+        }
+        return true;
+    }
+
+    // earliest[u] = 1 + tầng của u (có mask: kỳ mở đầu tiên sau mọi prereq);
+    // topo.success = false nếu có chu trình. Trả false nếu có môn không còn kỳ
+    // mở (earliest giữ kỳ theo prereq, như computeEarliestTerms).
+    bool analyze(TopoResult& topo, std::vector<int>& earliest) const {
+        topo.order.clear();
+        topo.levelStart.clear();
+        earliest.assign(V, 0);
+
+        std::bitset<N> done, level;
+        for (int u = 0; u < V; ++u) {
+            if (pre[u].none()) level.set(u);
+        }
+        bool ok = true;
+        int term = 1;
+        while (level.any()) {
+            topo.levelStart.push_back((int)topo.order.size());
+            std::bitset<N> cand;
+            for (int u = 0; u < V; ++u) {
+                if (!level.test(u)) continue;
+                topo.order.push_back(u);
+                earliest[u] = masked ? maskedTerm(u, earliest, ok) : term;
+                cand |= succ[u];
+            }
+            done |= level;
+            level.reset();
+            for (int u = 0; u < V; ++u) {
+                if (cand.test(u) && (pre[u] & ~done).none()) level.set(u);
+            }
+            ++term;
+        }
+        topo.levelStart.push_back((int)topo.order.size());
+        topo.success = (int)topo.order.size() == V;
+        return ok;
+    }
+
+    bool hasCycle() const {
+        TopoResult topo;
+        std::vector<int> earliest;
+        analyze(topo, earliest);
+        return !topo.success;
+    }
+
+private:
+    // prereq nằm ở tầng trước nên earliest của chúng đã xong
+    int maskedTerm(int u, const std::vector<int>& earliest, bool& ok) const {
+        int t = 1;
+        for (int p = 0; p < V; ++p) {
+            if (pre[u].test(p) && earliest[p] + 1 > t) t = earliest[p] + 1;
+        }
+        const int offered = nextOfferedTerm(mask[u], t);
+        if (offered == 0) {
+            ok = false;
+            return t;
+        }
+        return offered;
+    }
+};
+
+bool analyzeSmall(const CourseGraph& g, TopoResult& topo, std::vector<int>& earliest,
+                  bool* termsOk = nullptr);
@@ -1,26 +1,195 @@
 #include "TopoSort.h"
-#include <queue>
+#include "IndegreeKernel.h"
+#include "model/Curriculum.h"
+#include "util/Bits.h"
+#include "util/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
 using namespace std;
-TopoResult topoSort(const CourseGraph& topo) {
+namespace {
+// order vừa là kết quả vừa là hàng đợi FIFO: [head, tail) là các node chờ lấy
+TopoResult kahnFifo(const CourseGraph& topo) {
     TopoResult res;
     const int V = topo.V;
     vector<int> indeg = topo.indeg;
-    queue<int> q;
+    res.order.resize(V);
+    int tail = 0;
     for (int u = 0; u < V; u++) {
         if (indeg[u] == 0) {
-            q.push(u);
+            res.order[tail++] = u;
         }
     }
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
+    for (int head = 0; head < tail; head++) {
+        const CsrAdjacency::Row row = topo.adj[res.order[head]];
+        tail += decrementReady(indeg.data(), row.begin(), row.end(), res.order.data() + tail);
+    }
+    res.order.resize(tail);
+    res.success = tail == V;
+    return res;
+}
+}
+
+TopoResult topoSort(const CourseGraph& topo) {
+    return kahnFifo(topo);
+}
+
+// số node mỗi khối khi chia một tầng cho pool
+static constexpr int kLevelGrain = 512;
+
+TopoResult topoSortParallel(const CourseGraph& topo, ThreadPool& pool) {
+    TopoResult res;
+    const int V = topo.V;
+    unique_ptr<atomic<int>[]> indeg(new atomic<int>[V]);
+    for (int u = 0; u < V; u++) {
+        indeg[u].store(topo.indeg[u], memory_order_relaxed);
+    }
+
+    // order vừa là kết quả vừa là hàng đợi: tầng hiện tại = order[begin, end)
+    res.order.reserve(V);
+    for (int u = 0; u < V; u++) {
+        if (topo.indeg[u] == 0) res.order.push_back(u);
+    }
+    res.levelStart.push_back(0);
+
+    vector<vector<int>> ready(pool.size());
+    int begin = 0;
+    while (begin < (int)res.order.size()) {
+        const int end = (int)res.order.size();
+        const int* level = res.order.data() + begin;
+        pool.parallelFor(end - begin, kLevelGrain, [&](int b, int e, int w) {
+            auto& out = ready[w];
+            for (int i = b; i < e; i++) {
+                for (int v : topo.adj[level[i]]) {
+                    if (indeg[v].fetch_sub(1, memory_order_acq_rel) == 1) {
+                        out.push_back(v);
+                    }
+                }
+            }
+        });
+        for (auto& out : ready) {
+            res.order.insert(res.order.end(), out.begin(), out.end());
+            out.clear();
+        }
+        // thread nào hạ indeg về 0 là không xác định -> sắp lại để ổn định
+        sort(res.order.begin() + end, res.order.end());
+        res.levelStart.push_back(end);
+        begin = end;
+    }
+    res.success = (int)res.order.size() == V;
+    return res;
+}
+
+TopoResult topoSortParallel(const CourseGraph& topo, int numThreads) {
+    ThreadPool pool(numThreads);
+    return topoSortParallel(topo, pool);
+}
+
+namespace {
+
+// Hàng đợi ưu tiên trên các số nguyên phân biệt trong [0, n): cây bitmap 64 nhánh.
+// lv[0] là lá (1 bit/phần tử), bit của lv[k+1] bật khi word tương ứng của lv[k] khác 0.
+class BitmapHeap {
+public:
+    explicit BitmapHeap(int n) {
+        int m = n;
+        do {
+            m = max(1, (m + 63) / 64);
+            lv_.emplace_back(m, 0);
+        } while (m > 1);
+    }
+
+    bool empty() const { return lv_.back()[0] == 0; }
+
+    void push(int x) {
+        for (auto& l : lv_) {
+            uint64_t& w = l[x >> 6];
+            const bool had = w != 0;
+            w |= uint64_t(1) << (x & 63);
+            if (had) break;
+            x >>= 6;
+        }
+    }
+
+    int pop() {
+        int x = 0;
+        for (int k = (int)lv_.size() - 1; k >= 0; k--) {
+            x = x * 64 + lowestBit(lv_[k][x]);
+        }
+        const int res = x;
+        for (auto& l : lv_) {
+            uint64_t& w = l[x >> 6];
+            w &= ~(uint64_t(1) << (x & 63));
+            if (w) break;
+            x >>= 6;
+        }
+        return res;
+    }
+
+private:
+    vector<vector<uint64_t>> lv_;
+};
+
+} // namespace
+
+TopoResult topoSortByKey(const CourseGraph& topo, const vector<int64_t>& key) {
+    TopoResult res;
+    const int V = topo.V;
+    if ((int)key.size() != V) {
+        throw runtime_error("topoSortByKey: key size does not match graph");
+    }
+
+    // hạng duy nhất theo (key, idx)
+    vector<int> byRank(V);
+    iota(byRank.begin(), byRank.end(), 0);
+    sort(byRank.begin(), byRank.end(), [&](int a, int b) {
+        return key[a] != key[b] ? key[a] < key[b] : a < b;
+    });
+    vector<int> rank(V);
+    for (int r = 0; r < V; r++) rank[byRank[r]] = r;
+
+    vector<int> indeg = topo.indeg;
+    BitmapHeap heap(V);
+    for (int u = 0; u < V; u++) {
+        if (indeg[u] == 0) heap.push(rank[u]);
+    }
+    res.order.reserve(V);
+    while (!heap.empty()) {
+        const int u = byRank[heap.pop()];
         res.order.push_back(u);
         for (int v : topo.adj[u]) {
-            if (--indeg[v] == 0) {
-                q.push(v);
-            }
+            if (--indeg[v] == 0) heap.push(rank[v]);
         }
     }
     res.success = (int)res.order.size() == V;
     return res;
-}
\ No newline at end of file
+}
+
+vector<int64_t> topoKeyCriticalPath(const CourseGraph& topo) {
+    // số môn trên chuỗi dài nhất bắt đầu từ u; node thuộc chu trình giữ 1
+    TopoResult t = topoSort(topo);
+    vector<int64_t> height(topo.V, 1);
+    for (int i = (int)t.order.size() - 1; i >= 0; i--) {
+        const int u = t.order[i];
+        for (int v : topo.adj[u]) height[u] = max(height[u], height[v] + 1);
+    }
+    for (auto& h : height) h = -h;
+    return height;
+}
+
+vector<int64_t> topoKeyLexicographic(const CourseGraph& topo) {
+    vector<int> ids(topo.V);
+    iota(ids.begin(), ids.end(), 0);
+    sort(ids.begin(), ids.end(), [&](int a, int b) { return topo.idxToId[a] < topo.idxToId[b]; });
+    vector<int64_t> key(topo.V);
+    for (int r = 0; r < topo.V; r++) key[ids[r]] = r;
+    return key;
+}
+
+vector<int64_t> topoKeyCredits(const CourseGraph& topo, const Curriculum& cur) {
+    vector<int64_t> key(topo.V);
+    for (int u = 0; u < topo.V; u++) key[u] = cur.get(topo.idxToId[u]).credits;
+    return key;
+}
@@ -1,8 +1,33 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 #include "CourseGraph.h"
+
+class ThreadPool;
+class Curriculum;
+
 struct TopoResult {
     bool success = false;
     std::vector<int> order;
+    // Ranh giới tầng (chỉ topoSortParallel và SmallGraph điền): tầng k = order[levelStart[k] .. levelStart[k+1]).
+    // Tầng của một node = độ dài đường dài nhất từ nguồn tới nó (tầng 0 = nguồn).
+    std::vector<int> levelStart;
 };
-TopoResult topoSort(const CourseGraph& topo); //Kahn
\ No newline at end of file
+TopoResult topoSort(const CourseGraph& topo); //Kahn, giảm indeg bằng kernel trong IndegreeKernel.h
+
+// Kahn đồng bộ theo tầng: mọi node sẵn sàng của một tầng được xử lý song song,
+// indeg giảm bằng atomic. Trong mỗi tầng, node được sắp theo idx nên kết quả
+// không phụ thuộc số thread. numThreads = 0 -> hardware_concurrency.
+TopoResult topoSortParallel(const CourseGraph& topo, ThreadPool& pool);
+TopoResult topoSortParallel(const CourseGraph& topo, int numThreads = 0);
+
+// Kahn có ưu tiên: trong các node sẵn sàng, luôn lấy node có key nhỏ nhất,
+// hoà thì idx nhỏ hơn. key có size V. Key được đổi thành hạng duy nhất 0..V-1
+// rồi đưa vào hàng đợi bitmap 64 nhánh (push/pop O(log64 V)), nên thứ tự
+// chỉ phụ thuộc (key, idx): giống nhau giữa các lần chạy và các nền tảng.
+TopoResult topoSortByKey(const CourseGraph& topo, const std::vector<std::int64_t>& key);
+
+// Các key dựng sẵn cho topoSortByKey
+std::vector<std::int64_t> topoKeyCriticalPath(const CourseGraph& topo);   // chuỗi phía sau dài hơn ra trước
+std::vector<std::int64_t> topoKeyLexicographic(const CourseGraph& topo);  // theo id (so byte)
+std::vector<std::int64_t> topoKeyCredits(const CourseGraph& topo, const Curriculum& cur); // ít tín chỉ ra trước
@@ -0,0 +1,85 @@
+#include "TransitiveReduction.h"
+#include "TopoSort.h"
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+ReductionResult reduceTransitive(CourseGraph& g, size_t maxBitsetBytes) {
+    ReductionResult res;
+    TopoResult topo = topoSort(g);
+    if (!topo.success) return res;
+    res.success = true;
+
+    const int V = g.V;
+    vector<int> pos(V);
+    for (int p = 0; p < V; p++) pos[topo.order[p]] = p;
+
+    // redundant[e]: cạnh thứ e của g.adj (theo offset CSR) bị bỏ
+    vector<char> redundant(g.E, 0);
+
+    // Cạnh lặp: giữ bản đầu tiên
+    vector<int> seen(V, -1);
+    for (int u = 0; u < V; u++) {
+        for (int e = g.adj.offset[u]; e < g.adj.offset[u + 1]; e++) {
+            int v = g.adj.target[e];
+            if (seen[v] == u) redundant[e] = 1;
+            seen[v] = u;
+        }
+    }
+
+    // Khối cột [lo, hi) theo vị trí topo; chỉ node có vị trí < hi mới chạm tới khối
+    const size_t rowBytesPerWord = sizeof(uint64_t) * max(V, 1);
+    const int blockWords = (int)max<size_t>(1, maxBitsetBytes / rowBytesPerWord);
+    const int blockBits = blockWords * 64;
+    vector<uint64_t> reach, acc(blockWords);
+
+    for (int lo = 0; lo < V; lo += blockBits) {
+        const int hi = min(V, lo + blockBits);
+        const int W = (hi - lo + 63) / 64;
+        reach.assign((size_t)hi * W, 0);
+
+        for (int p = hi - 1; p >= 0; p--) {
+            const int u = topo.order[p];
+            fill(acc.begin(), acc.begin() + W, 0);
+            // acc = các node trong khối đạt được từ u qua >= 2 cạnh
+            for (int v : g.adj[u]) {
+                const int q = pos[v];
+                if (q >= hi) continue;
+                const uint64_t* src = &reach[(size_t)q * W];
+                for (int w = 0; w < W; w++) acc[w] |= src[w];
+            }
+            uint64_t* row = &reach[(size_t)p * W];
+            for (int w = 0; w < W; w++) row[w] = acc[w];
+            for (int e = g.adj.offset[u]; e < g.adj.offset[u + 1]; e++) {
+                const int q = pos[g.adj.target[e]];
+                if (q < lo || q >= hi) continue;
+                const int bit = q - lo;
+                if (acc[bit >> 6] >> (bit & 63) & 1) redundant[e] = 1;
+                row[bit >> 6] |= uint64_t(1) << (bit & 63);
+            }
+        }
+    }
+
+    // Dựng lại CSR từ các cạnh còn giữ (giữ nguyên thứ tự)
+    vector<int> from, to;
+    from.reserve(g.E);
+    to.reserve(g.E);
+    for (int u = 0; u < V; u++) {
+        for (int e = g.adj.offset[u]; e < g.adj.offset[u + 1]; e++) {
+            const int v = g.adj.target[e];
+            if (redundant[e]) {
+                res.removed.push_back({u, v});
+            } else {
+                from.push_back(u);
+                to.push_back(v);
+            }
+        }
+    }
+    if (res.removed.empty()) return res;
+
+    g.E = (int)from.size();
+    g.adj.assign(V, from, to);
+    g.radj.assign(V, to, from);
+    for (int u = 0; u < V; u++) g.indeg[u] = g.radj.degree(u);
+    return res;
+}
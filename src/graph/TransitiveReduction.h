@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "CourseGraph.h"
+
+// Cạnh prereq -> course bị bỏ vì course vẫn đạt được từ prereq qua đường khác
+// (vd CALC1 -> CALC3 khi đã có CALC1 -> CALC2 -> CALC3), hoặc cạnh lặp.
+struct RedundantEdge {
+    int prereq;
+    int course;
+};
+
+struct ReductionResult {
+    bool success = false;               // false nếu đồ thị có chu trình (g giữ nguyên)
+    std::vector<RedundantEdge> removed; // theo thứ tự cạnh trong g.adj
+};
+
+// Rút gọn bắc cầu tại chỗ (chạy tùy chọn sau CourseGraph::build).
+// Bao đóng tính bằng bitset theo thứ tự topo, mỗi lần một khối cột để bộ nhớ
+// bitset không vượt maxBitsetBytes; tổng công ~ O(E * V / 64).
+ReductionResult reduceTransitive(CourseGraph& g, std::size_t maxBitsetBytes = std::size_t(64) << 20);
@@ -0,0 +1,51 @@
+#include "WeakComponents.h"
+#include <algorithm>
+using namespace std;
+
+ComponentDecomposition findWeakComponents(const CourseGraph& g) {
+    ComponentDecomposition res;
+    res.compOf.assign(g.V, -1);
+    vector<int> st;
+    for (int s = 0; s < g.V; s++) {
+        if (res.compOf[s] != -1) continue;
+        const int c = res.count++;
+        res.members.emplace_back();
+        res.compOf[s] = c;
+        st.push_back(s);
+        while (!st.empty()) {
+            const int u = st.back();
+            st.pop_back();
+            res.members[c].push_back(u);
+            for (int v : g.adj[u]) {
+                if (res.compOf[v] == -1) { res.compOf[v] = c; st.push_back(v); }
+            }
+            for (int v : g.radj[u]) {
+                if (res.compOf[v] == -1) { res.compOf[v] = c; st.push_back(v); }
+            }
+        }
+    }
+    for (auto& m : res.members) sort(m.begin(), m.end());
+    return res;
+}
+
+CourseGraph inducedSubgraph(const CourseGraph& g, const vector<int>& members) {
+    CourseGraph sub;
+    sub.V = (int)members.size();
+    vector<int> from, to;
+    // vị trí trong members, tra bằng tìm nhị phân (members tăng dần)
+    auto local = [&](int u) { return (int)(lower_bound(members.begin(), members.end(), u) - members.begin()); };
+    for (int i = 0; i < sub.V; i++) {
+        for (int v : g.adj[members[i]]) {
+            from.push_back(i);
+            to.push_back(local(v));
+        }
+    }
+    sub.E = (int)from.size();
+    sub.adj.assign(sub.V, from, to);
+    sub.radj.assign(sub.V, to, from);
+    sub.indeg.assign(sub.V, 0);
+    for (int x = 0; x < sub.V; x++) sub.indeg[x] = sub.radj.degree(x);
+    sub.offeredMask.assign(sub.V, 0);
+    for (int i = 0; i < sub.V; i++) sub.offeredMask[i] = g.offered(members[i]);
+    return sub;
+}
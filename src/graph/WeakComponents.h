@@ -0,0 +1,24 @@
+/*
+ * WeakComponents
+ * Tách CourseGraph thành các thành phần liên thông yếu (bỏ hướng cạnh).
+ * Hai thành phần khác nhau không có prereq nào nối nhau nên topo / earliest term
+ * / xếp kỳ của chúng độc lập, chỉ dùng chung quota tín chỉ mỗi kỳ.
+ *
+ * - compOf[u]: thành phần của u; thành phần đánh số theo idx nhỏ nhất của nó
+ * - members[c]: các idx thuộc thành phần c, tăng dần
+ */
+#pragma once
+#include <vector>
+#include "CourseGraph.h"
+
+struct ComponentDecomposition {
+    int count = 0;
+    std::vector<int> compOf;
+    std::vector<std::vector<int>> members;
+};
+
+ComponentDecomposition findWeakComponents(const CourseGraph& g);
+
+// Đồ thị con chỉ gồm members (idx cục bộ = vị trí trong members); chỉ dựng
+// cấu trúc (adj/radj/indeg), không có idToIdx / idxToId.
+CourseGraph inducedSubgraph(const CourseGraph& g, const std::vector<int>& members);
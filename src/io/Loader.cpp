@@ -59,7 +59,6 @@ namespace planner {
         if (!j.is_array()) {
             throw LoadException("Trường courses phải là mảng", "INVALID_TYPE", context);
         }
-        Curriculum curriculum;
         std::unordered_set<std::string> courseIds;
         std::vector<Course> parsedCourses;
 
@@ -101,10 +100,7 @@ namespace planner {
             }
         }
 
-        for (const auto& c : parsedCourses) {
-            curriculum.add(c);
-        }
-        return curriculum;
+        return Curriculum(std::move(parsedCourses));
     }
 
     Course parseCourse(const nlohmann::json& j,
@@ -132,6 +128,9 @@ namespace planner {
         if (j.contains("elective_groups") && !j["elective_groups"].is_null()) {
             course.elective_groups = j["elective_groups"].get<std::string>();
         }
+        if (j.contains("track") && !j["track"].is_null()) {
+            course.track = parseNonEmptyString(j["track"], context + ".track");
+        }
 
         if (j.contains("offered_terms")) {
             std::vector<int> terms = parseIntArray(j, "offered_terms", context + ".offered_terms");
@@ -0,0 +1,265 @@
+#include "Snapshot.h"
+#include "Loader.h"
+#include "graph/TopoSort.h"
+#include "planner/LongestPathDag.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace planner {
+
+    namespace {
+        const char kMagic[8] = {'C', 'P', 'S', 'N', 'A', 'P', 0, 0};
+
+        std::uint64_t fnv1a64(const char* p, std::size_t n) {
+            std::uint64_t h = 1469598103934665603ull;
+            for (std::size_t i = 0; i < n; ++i) {
+                h ^= static_cast<unsigned char>(p[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        // Nối section vào buffer, căn 8 byte; trả offset bắt đầu
+        template <class T>
+        std::uint64_t appendSection(std::vector<char>& buf, const T* data, std::size_t count) {
+            buf.resize((buf.size() + 7) & ~std::size_t(7), 0);
+            const std::uint64_t at = buf.size();
+            const char* p = reinterpret_cast<const char*>(data);
+            buf.insert(buf.end(), p, p + count * sizeof(T));
+            return at;
+        }
+    }
+
+    void writeSnapshot(const std::string& path, const Curriculum& cur, const CourseGraph& g) {
+        const int V = g.V;
+
+        std::vector<std::uint32_t> idOffset(V + 1, 0);
+        std::string idChars;
+        for (int u = 0; u < V; ++u) {
+            idChars += g.idxToId[u];
+            idOffset[u + 1] = static_cast<std::uint32_t>(idChars.size());
+        }
+        std::vector<std::uint32_t> idSorted(V);
+        std::iota(idSorted.begin(), idSorted.end(), 0u);
+        std::sort(idSorted.begin(), idSorted.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return g.idxToId[a] < g.idxToId[b];
+        });
+
+        std::vector<std::uint16_t> credits(V);
+        std::vector<std::uint64_t> offered(V, 0);
+        for (int u = 0; u < V; ++u) {
+            const Course& c = cur.get(g.idxToId[u]);
+            credits[u] = c.credits;
+            for (unsigned short t : c.offered_terms) {
+                if (t < 1 || t > 64) {
+                    throw LoadException(
+                        "Snapshot: offered term " + std::to_string(t) + " của " + c.id + " nằm ngoài [1..64]",
+                        "SNAPSHOT_TERM_RANGE",
+                        path
+                    );
+                }
+                offered[u] |= std::uint64_t(1) << (t - 1);
+            }
+        }
+
+        TopoResult topo;
+        std::vector<int> earliest = topoAndEarliestTerms(g, topo).termByIdx;
+
+        SnapshotHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version = kSnapshotVersion;
+        h.flags = topo.success ? 1u : 0u;
+        h.numCourses = static_cast<std::uint32_t>(V);
+        h.numEdges = static_cast<std::uint32_t>(g.E);
+
+        std::vector<char> buf(sizeof(SnapshotHeader), 0);
+        h.section[SEC_ID_OFFSET] = appendSection(buf, idOffset.data(), idOffset.size());
+        h.section[SEC_ID_CHARS] = appendSection(buf, idChars.data(), idChars.size());
+        h.section[SEC_ID_SORTED] = appendSection(buf, idSorted.data(), idSorted.size());
+        h.section[SEC_CREDITS] = appendSection(buf, credits.data(), credits.size());
+        h.section[SEC_OFFERED_MASK] = appendSection(buf, offered.data(), offered.size());
+        h.section[SEC_ADJ_OFFSET] = appendSection(buf, g.adj.offset.data(), g.adj.offset.size());
+        h.section[SEC_ADJ_TARGET] = appendSection(buf, g.adj.target.data(), g.adj.target.size());
+        h.section[SEC_RADJ_OFFSET] = appendSection(buf, g.radj.offset.data(), g.radj.offset.size());
+        h.section[SEC_RADJ_TARGET] = appendSection(buf, g.radj.target.data(), g.radj.target.size());
+        h.section[SEC_TOPO_ORDER] = appendSection(buf, topo.order.data(), topo.success ? topo.order.size() : 0);
+        h.section[SEC_EARLIEST_TERM] = appendSection(buf, earliest.data(), earliest.size());
+        buf.resize((buf.size() + 7) & ~std::size_t(7), 0);
+
+        h.fileSize = buf.size();
+        h.checksum = fnv1a64(buf.data() + sizeof(SnapshotHeader), buf.size() - sizeof(SnapshotHeader));
+        std::memcpy(buf.data(), &h, sizeof(h));
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.write(buf.data(), static_cast<std::streamsize>(buf.size()))) {
+            throw LoadException("Snapshot: không ghi được file: " + path, "SNAPSHOT_IO", path);
+        }
+    }
+
+    Snapshot Snapshot::open(const std::string& path, bool verifyChecksum) {
+        Snapshot s;
+#ifdef _WIN32
+        HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw LoadException("Snapshot: không mở được file: " + path, "SNAPSHOT_IO", path);
+        }
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(SnapshotHeader)) {
+            ::CloseHandle(file);
+            throw LoadException("Snapshot: file quá nhỏ: " + path, "SNAPSHOT_FORMAT", path);
+        }
+        // view giữ mapping sống; đóng cả hai handle ngay sau MapViewOfFile
+        HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        const void* p = mapping ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mapping) ::CloseHandle(mapping);
+        if (!p) {
+            throw LoadException("Snapshot: MapViewOfFile thất bại: " + path, "SNAPSHOT_IO", path);
+        }
+        s.size_ = static_cast<std::size_t>(fileSize.QuadPart);
+        s.base_ = static_cast<const char*>(p);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw LoadException("Snapshot: không mở được file: " + path, "SNAPSHOT_IO", path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(SnapshotHeader)) {
+            ::close(fd);
+            throw LoadException("Snapshot: file quá nhỏ: " + path, "SNAPSHOT_FORMAT", path);
+        }
+        s.size_ = static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(nullptr, s.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            s.size_ = 0;
+            throw LoadException("Snapshot: mmap thất bại: " + path, "SNAPSHOT_IO", path);
+        }
+        s.base_ = static_cast<const char*>(p);
+#endif
+
+        auto fail = [&](const std::string& what, const char* code) {
+            throw LoadException("Snapshot: " + what + ": " + path, code, path);
+        };
+        if (s.size_ < sizeof(SnapshotHeader)) fail("file quá nhỏ", "SNAPSHOT_FORMAT");
+        const SnapshotHeader& h = s.header();
+        if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) fail("sai magic", "SNAPSHOT_FORMAT");
+        if (h.version != kSnapshotVersion) fail("version " + std::to_string(h.version) + " không hỗ trợ", "SNAPSHOT_FORMAT");
+        if (h.fileSize != s.size_) fail("kích thước không khớp header", "SNAPSHOT_FORMAT");
+
+        // Kiểm tra mọi section nằm trọn trong file và căn đúng
+        const std::uint64_t V = h.numCourses, E = h.numEdges;
+        const std::uint64_t order = (h.flags & 1u) ? V : 0;
+        auto inFile = [&](int sec, std::uint64_t bytes) {
+            const std::uint64_t at = h.section[sec];
+            return at % 8 == 0 && at >= sizeof(SnapshotHeader) && at <= s.size_ && bytes <= s.size_ - at;
+        };
+        bool ok = inFile(SEC_ID_OFFSET, (V + 1) * 4);
+        if (ok) ok = inFile(SEC_ID_CHARS, s.section<std::uint32_t>(SEC_ID_OFFSET)[V]);
+        ok = ok && inFile(SEC_ID_SORTED, V * 4) && inFile(SEC_CREDITS, V * 2) &&
+             inFile(SEC_OFFERED_MASK, V * 8) &&
+             inFile(SEC_ADJ_OFFSET, (V + 1) * 4) && inFile(SEC_ADJ_TARGET, E * 4) &&
+             inFile(SEC_RADJ_OFFSET, (V + 1) * 4) && inFile(SEC_RADJ_TARGET, E * 4) &&
+             inFile(SEC_TOPO_ORDER, order * 4) && inFile(SEC_EARLIEST_TERM, order * 4);
+        if (!ok) fail("section nằm ngoài file", "SNAPSHOT_FORMAT");
+
+        if (verifyChecksum &&
+            fnv1a64(s.base_ + sizeof(SnapshotHeader), s.size_ - sizeof(SnapshotHeader)) != h.checksum) {
+            fail("checksum không khớp", "SNAPSHOT_CHECKSUM");
+        }
+
+        // Luôn kiểm tra cấu trúc (kể cả khi bỏ checksum): id(), adj(), radj() đọc
+        // thẳng theo offset nên offset phải bắt đầu từ 0, không giảm, kết thúc đúng
+        // độ dài section; mọi chỉ số node phải < V.
+        auto monotonic = [&](int sec, std::uint64_t last) {
+            const std::uint32_t* off = s.section<std::uint32_t>(sec);
+            if (off[0] != 0 || off[V] != last) return false;
+            for (std::uint64_t u = 0; u < V; ++u) {
+                if (off[u] > off[u + 1]) return false;
+            }
+            return true;
+        };
+        auto nodesOk = [&](int sec, std::uint64_t n) {
+            const std::uint32_t* a = s.section<std::uint32_t>(sec);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                if (a[i] >= V) return false;
+            }
+            return true;
+        };
+        const std::uint64_t chars = s.section<std::uint32_t>(SEC_ID_OFFSET)[V];
+        if (!monotonic(SEC_ID_OFFSET, chars) || !monotonic(SEC_ADJ_OFFSET, E) ||
+            !monotonic(SEC_RADJ_OFFSET, E)) {
+            fail("offset không hợp lệ", "SNAPSHOT_FORMAT");
+        }
+        if (!nodesOk(SEC_ADJ_TARGET, E) || !nodesOk(SEC_RADJ_TARGET, E) ||
+            !nodesOk(SEC_ID_SORTED, V) || !nodesOk(SEC_TOPO_ORDER, order)) {
+            fail("chỉ số node ngoài [0, V)", "SNAPSHOT_FORMAT");
+        }
+        return s;
+    }
+
+    Snapshot::Snapshot(Snapshot&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    Snapshot& Snapshot::operator=(Snapshot&& other) noexcept {
+        if (this != &other) {
+            release();
+            base_ = std::exchange(other.base_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    Snapshot::~Snapshot() { release(); }
+
+    void Snapshot::release() {
+        if (!base_) return;
+#ifdef _WIN32
+        ::UnmapViewOfFile(base_);
+#else
+        ::munmap(const_cast<char*>(base_), size_);
+#endif
+        base_ = nullptr;
+        size_ = 0;
+    }
+
+    std::string_view Snapshot::id(int u) const {
+        const std::uint32_t* off = section<std::uint32_t>(SEC_ID_OFFSET);
+        return std::string_view(section<char>(SEC_ID_CHARS) + off[u], off[u + 1] - off[u]);
+    }
+
+    int Snapshot::indexOf(std::string_view key) const {
+        const std::uint32_t* sorted = section<std::uint32_t>(SEC_ID_SORTED);
+        const std::uint32_t* last = sorted + numCourses();
+        const std::uint32_t* it = std::lower_bound(sorted, last, key, [&](std::uint32_t u, std::string_view k) {
+            return id((int)u) < k;
+        });
+        return (it != last && id((int)*it) == key) ? (int)*it : -1;
+    }
+
+    CsrAdjacency::Row Snapshot::row(int offSec, int targetSec, int u) const {
+        const int* off = section<int>(offSec);
+        const int* target = section<int>(targetSec);
+        return CsrAdjacency::Row{target + off[u], target + off[u + 1]};
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Snapshot nhị phân của curriculum đã biên dịch.
+ *
+ * Sinh một lần bằng writeSnapshot (tool: course_snapshot), sau đó mỗi process
+ * chỉ cần Snapshot::open: file được map chỉ đọc (mmap; MapViewOfFile trên
+ * Windows) và dùng tại chỗ, không parse JSON, không dựng lại Curriculum /
+ * CourseGraph, không copy.
+ *
+ * Bố cục (native endian, mọi section căn 8 byte):
+ *   SnapshotHeader | idOffset[V+1] | idChars | idSorted[V] | credits[V]
+ *   | offeredMask[V] | adjOffset[V+1] | adjTarget[E] | radjOffset[V+1]
+ *   | radjTarget[E] | topoOrder[V] | earliestTerm[V]
+ * topoOrder / earliestTerm chỉ có khi đồ thị không chu trình (hasOrder()).
+ * offeredMask: bit (t-1) bật nếu môn mở ở kỳ t; 0 = mở mọi kỳ.
+ *
+ * Lỗi (ném planner::LoadException):
+ * - SNAPSHOT_IO: không mở / đọc / ghi được file
+ * - SNAPSHOT_FORMAT: sai magic, version, kích thước, offset hoặc chỉ số node
+ *   (luôn kiểm tra, kể cả open(path, false))
+ * - SNAPSHOT_CHECKSUM: checksum không khớp
+ * - SNAPSHOT_TERM_RANGE: offered_terms > 64 không biểu diễn được bằng mask
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "graph/CourseGraph.h"
+#include "model/Curriculum.h"
+
+namespace planner
+{
+    constexpr std::uint32_t kSnapshotVersion = 1;
+
+    enum SnapshotSection : int
+    {
+        SEC_ID_OFFSET = 0,
+        SEC_ID_CHARS,
+        SEC_ID_SORTED,
+        SEC_CREDITS,
+        SEC_OFFERED_MASK,
+        SEC_ADJ_OFFSET,
+        SEC_ADJ_TARGET,
+        SEC_RADJ_OFFSET,
+        SEC_RADJ_TARGET,
+        SEC_TOPO_ORDER,
+        SEC_EARLIEST_TERM,
+        SEC_COUNT
+    };
+
+    struct SnapshotHeader
+    {
+        char magic[8];              // "CPSNAP\0\0"
+        std::uint32_t version;
+        std::uint32_t flags;        // bit 0: có topoOrder + earliestTerm
+        std::uint32_t numCourses;
+        std::uint32_t numEdges;
+        std::uint64_t fileSize;
+        std::uint64_t checksum;     // FNV-1a 64 trên mọi byte sau header
+        std::uint64_t section[SEC_COUNT]; // offset tính từ đầu file
+    };
+
+    // Ghi snapshot cho (cur, g); g phải được build từ cur. Tự tính topo + earliest term.
+    void writeSnapshot(const std::string &path, const Curriculum &cur, const CourseGraph &g);
+
+    class Snapshot
+    {
+    public:
+        static Snapshot open(const std::string &path, bool verifyChecksum = true);
+
+        Snapshot() = default;
+        Snapshot(Snapshot &&other) noexcept;
+        Snapshot &operator=(Snapshot &&other) noexcept;
+        Snapshot(const Snapshot &) = delete;
+        Snapshot &operator=(const Snapshot &) = delete;
+        ~Snapshot();
+
+        int numCourses() const { return (int)header().numCourses; }
+        int numEdges() const { return (int)header().numEdges; }
+        bool hasOrder() const { return header().flags & 1u; }
+
+        std::string_view id(int u) const;
+        int indexOf(std::string_view id) const; // -1 nếu không có (tìm nhị phân trên idSorted)
+        unsigned short credits(int u) const { return section<std::uint16_t>(SEC_CREDITS)[u]; }
+        std::uint64_t offeredMask(int u) const { return section<std::uint64_t>(SEC_OFFERED_MASK)[u]; }
+
+        CsrAdjacency::Row adj(int u) const { return row(SEC_ADJ_OFFSET, SEC_ADJ_TARGET, u); }
+        CsrAdjacency::Row radj(int u) const { return row(SEC_RADJ_OFFSET, SEC_RADJ_TARGET, u); }
+
+        // nullptr nếu !hasOrder()
+        const int *topoOrder() const { return hasOrder() ? section<int>(SEC_TOPO_ORDER) : nullptr; }
+        const int *earliestTerms() const { return hasOrder() ? section<int>(SEC_EARLIEST_TERM) : nullptr; }
+
+        std::size_t sizeBytes() const { return size_; }
+
+    private:
+        const SnapshotHeader &header() const { return *reinterpret_cast<const SnapshotHeader *>(base_); }
+        template <class T>
+        const T *section(int s) const { return reinterpret_cast<const T *>(base_ + header().section[s]); }
+        CsrAdjacency::Row row(int offSec, int targetSec, int u) const;
+        void release();
+
+        const char *base_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}
@@ -16,4 +16,5 @@ struct Course {
     std::vector<std::string> corequisite;
     std::optional<std::string> elective_groups;
     std::unordered_set<unsigned short> offered_terms;
+    std::string track; // nhóm hiển thị (General, ITCore, ...); rỗng nếu không có
 };
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "CourseIdTable.h"
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <stdexcept>
+
+namespace {
+    std::uint64_t mix64(std::uint64_t x) {
+        x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27; x *= 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    std::uint64_t hashId(std::string_view s, std::uint64_t seed) {
+        std::uint64_t h = 0xCBF29CE484222325ULL ^ seed; // FNV-1a 64
+        for (unsigned char ch : s) {
+            h ^= ch;
+            h *= 0x100000001B3ULL;
+        }
+        return mix64(h);
+    }
+
+    // [0, n) từ 32 bit cao, không cần phép chia
+    std::uint32_t reduce(std::uint64_t x, std::uint32_t n) {
+        return static_cast<std::uint32_t>(((x >> 32) * n) >> 32);
+    }
+
+    constexpr std::uint32_t kMaxPilot = 1u << 22;
+    constexpr int kMaxSeeds = 16;
+}
+
+std::uint32_t CourseIdTable::bucketOf(std::uint64_t h) const {
+    return reduce(h, static_cast<std::uint32_t>(pilot_.size()));
+}
+
+std::uint32_t CourseIdTable::slotOf(std::uint64_t h, std::uint32_t pilot) const {
+    return reduce(mix64(h ^ (pilot * 0x9E3779B97F4A7C15ULL)), static_cast<std::uint32_t>(slotToHandle_.size()));
+}
+
+void CourseIdTable::clear() {
+    names_.clear();
+    pilot_.clear();
+    slotToHandle_.clear();
+    tail_.clear();
+    seed_ = 0;
+}
+
+void CourseIdTable::build(std::vector<std::string> ids) {
+    clear();
+    for (const auto& id : ids) {
+        if (id.empty()) throw std::runtime_error("CourseIdTable: empty id");
+    }
+    if (ids.size() >= npos) throw std::runtime_error("CourseIdTable: too many ids");
+    names_ = std::move(ids);
+    rehash();
+}
+
+CourseHandle CourseIdTable::append(std::string id) {
+    if (id.empty()) throw std::runtime_error("CourseIdTable: empty id");
+    const CourseHandle found = find(id);
+    if (found != npos) return found;
+    if (names_.size() + 1 >= npos) throw std::runtime_error("CourseIdTable: too many ids");
+    const CourseHandle h = static_cast<CourseHandle>(names_.size());
+    names_.push_back(id);
+    tail_.emplace(std::move(id), h);
+    // dựng lại khi phần ngoài hash gấp đôi phần trong: tổng chi phí append vẫn O(n)
+    if (tail_.size() > slotToHandle_.size()) rehash();
+    return h;
+}
+
+void CourseIdTable::rehash() {
+    tail_.clear();
+    pilot_.clear();
+    slotToHandle_.clear();
+    if (names_.empty()) return;
+
+    std::vector<std::uint64_t> hashes(names_.size());
+    for (int attempt = 0; attempt < kMaxSeeds; ++attempt) {
+        seed_ = mix64(0x5EED0000ULL + attempt);
+        for (std::size_t i = 0; i < names_.size(); ++i) hashes[i] = hashId(names_[i], seed_);
+        if (tryBuild(hashes)) return;
+    }
+    throw std::runtime_error("CourseIdTable: could not build perfect hash");
+}
+
+// Hash-and-displace: xếp bucket lớn trước, mỗi bucket dò pilot tới khi mọi key rơi vào slot trống
+bool CourseIdTable::tryBuild(const std::vector<std::uint64_t>& hashes) {
+    const std::uint32_t n = static_cast<std::uint32_t>(names_.size());
+    slotToHandle_.assign(n, npos);
+    const std::uint32_t numBuckets = std::max<std::uint32_t>(1, n / 2);
+    pilot_.assign(numBuckets, 0);
+
+    // gom key theo bucket (counting sort)
+    std::vector<std::uint32_t> start(numBuckets + 1, 0), keys(n);
+    for (std::uint32_t i = 0; i < n; ++i) start[bucketOf(hashes[i]) + 1]++;
+    for (std::uint32_t b = 0; b < numBuckets; ++b) start[b + 1] += start[b];
+    {
+        std::vector<std::uint32_t> cur(start.begin(), start.end() - 1);
+        for (std::uint32_t i = 0; i < n; ++i) keys[cur[bucketOf(hashes[i])]++] = i;
+    }
+
+    std::vector<std::uint32_t> order(numBuckets);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return start[a + 1] - start[a] > start[b + 1] - start[b];
+    });
+
+    std::vector<std::uint32_t> taken;
+    for (std::uint32_t b : order) {
+        const std::uint32_t first = start[b], last = start[b + 1];
+        if (first == last) break; // các bucket sau đều rỗng
+
+        // hai key cùng hash: trùng id thật -> lỗi; khác id -> đổi seed
+        for (std::uint32_t i = first; i < last; ++i) {
+            for (std::uint32_t j = i + 1; j < last; ++j) {
+                if (hashes[keys[i]] != hashes[keys[j]]) continue;
+                if (names_[keys[i]] == names_[keys[j]]) {
+                    throw std::runtime_error("CourseIdTable: duplicate id: " + names_[keys[i]]);
+                }
+                return false;
+            }
+        }
+
+        bool placed = false;
+        for (std::uint32_t pilot = 0; pilot < kMaxPilot && !placed; ++pilot) {
+            taken.clear();
+            bool ok = true;
+            for (std::uint32_t i = first; i < last && ok; ++i) {
+                const std::uint32_t s = slotOf(hashes[keys[i]], pilot);
+                if (slotToHandle_[s] != npos || std::find(taken.begin(), taken.end(), s) != taken.end()) {
+                    ok = false;
+                } else {
+                    taken.push_back(s);
+                }
+            }
+            if (!ok) continue;
+            for (std::uint32_t i = first; i < last; ++i) {
+                slotToHandle_[taken[i - first]] = keys[i];
+            }
+            pilot_[b] = pilot;
+            placed = true;
+        }
+        if (!placed) return false;
+    }
+    return true;
+}
+
+CourseHandle CourseIdTable::find(std::string_view id) const {
+    if (!slotToHandle_.empty()) {
+        const std::uint64_t h = hashId(id, seed_);
+        const CourseHandle handle = slotToHandle_[slotOf(h, pilot_[bucketOf(h)])];
+        if (names_[handle] == id) return handle;
+    }
+    if (tail_.empty()) return npos;
+    auto it = tail_.find(std::string(id));
+    return it != tail_.end() ? it->second : npos;
+}
+
+int CourseIdTable::at(std::string_view id) const {
+    const CourseHandle h = find(id);
+    if (h == npos) {
+        throw std::out_of_range("CourseIdTable::at: unknown course id: " + std::string(id));
+    }
+    return static_cast<int>(h);
+}
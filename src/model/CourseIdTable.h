@@ -0,0 +1,53 @@
+/*Bảng intern mã môn: mỗi id (string) được gán một handle 32-bit liên tục 0..n-1
+theo thứ tự nạp, tra cứu bằng minimal perfect hash dựng một lần lúc load.
+
+- build(ids): dựng bảng; ném std::runtime_error nếu id rỗng hoặc trùng.
+- append(id): handle của id, thêm vào cuối nếu chưa có. Id mới nằm trong bảng phụ
+  (unordered_map) tới khi bảng phụ lớn hơn phần đã hash thì dựng lại cả bảng,
+  nên n lần append tốn O(n) khấu hao.
+- find(id): handle hoặc npos; at(id): như find nhưng ném std::out_of_range.
+- name(h): id gốc của handle.
+
+Tra cứu = 1 lần hash + 2 lần đọc mảng + 1 lần so chuỗi, không cấp phát
+(khi bảng phụ rỗng: sau build hoặc sau lần dựng lại cuối).
+
+AC: Mọi id đã nạp tra ra đúng handle; id lạ trả npos.*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using CourseHandle = std::uint32_t;
+
+class CourseIdTable {
+public:
+    static constexpr CourseHandle npos = 0xFFFFFFFFu;
+
+    void build(std::vector<std::string> ids);
+    CourseHandle append(std::string id);
+    void clear();
+
+    CourseHandle find(std::string_view id) const;
+    int at(std::string_view id) const;
+    std::size_t count(std::string_view id) const { return find(id) != npos ? 1 : 0; }
+
+    std::size_t size() const { return names_.size(); }
+    bool empty() const { return names_.empty(); }
+    const std::string& name(CourseHandle h) const { return names_[h]; }
+    const std::vector<std::string>& names() const { return names_; }
+
+private:
+    void rehash();
+    bool tryBuild(const std::vector<std::uint64_t>& hashes);
+    std::uint32_t bucketOf(std::uint64_t h) const;
+    std::uint32_t slotOf(std::uint64_t h, std::uint32_t pilot) const;
+
+    std::vector<std::string> names_;
+    std::vector<std::uint32_t> pilot_;        // độ dời cho mỗi bucket
+    std::vector<CourseHandle> slotToHandle_;  // slot [0, n) -> handle
+    std::unordered_map<std::string, CourseHandle> tail_; // id append sau lần hash cuối
+    std::uint64_t seed_ = 0;
+};
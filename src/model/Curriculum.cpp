@@ -1 +0,0 @@
-#include "Curriculum.h"
\ No newline at end of file
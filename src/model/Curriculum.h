@@ -1,32 +1,65 @@
 #pragma once
-#include <unordered_map>
+#include <deque>
+#include <iterator>
 #include <string>
 #include <stdexcept>
+#include <vector>
 #include "Course.h"
+#include "CourseIdTable.h"
 
+// Lưu môn theo thứ tự nạp + bảng intern id -> handle (CourseIdTable).
+// Handle của môn = vị trí trong thứ tự nạp = idx của CourseGraph dựng từ Curriculum này,
+// nên CourseGraph::build dùng lại đúng bảng này thay vì hash lại từng id.
+//
+// add() cập nhật bảng ngay (id đã có: thay nội dung tại chỗ, giữ handle), nên các
+// hàm const không ghi gì và đọc đồng thời từ nhiều thread là an toàn khi không ai add.
+// Môn nằm trong deque: add() không làm mất hiệu lực const Course& đã lấy từ get().
 class Curriculum {
 public:
+    Curriculum() = default;
+    // Nạp một lần; ném std::runtime_error nếu id rỗng hoặc trùng
+    explicit Curriculum(std::vector<Course> courses) {
+        std::vector<std::string> names;
+        names.reserve(courses.size());
+        for (const auto& c : courses) names.push_back(c.id);
+        ids_.build(std::move(names));
+        courses_.assign(std::make_move_iterator(courses.begin()), std::make_move_iterator(courses.end()));
+    }
+
     bool exists(const std::string& courseId) const {
-        return courses.find(courseId) != courses.end();
+        return ids_.find(courseId) != CourseIdTable::npos;
     }
 
     const Course& get(const std::string& courseId) const {
-        auto it = courses.find(courseId);
-        if (it == courses.end()) {
+        const CourseHandle h = ids_.find(courseId);
+        if (h == CourseIdTable::npos) {
             throw std::runtime_error("Curriculum::get: unknown course id: " + courseId);
         }
-        return it->second;
+        return courses_[h];
     }
+    const Course& get(CourseHandle h) const { return courses_[h]; }
 
+    // Ném std::runtime_error nếu id rỗng
     void add(const Course& c) {
-        courses[c.id] = c;
+        const CourseHandle h = ids_.append(c.id);
+        if (h < courses_.size()) {
+            courses_[h] = c;
+        } else {
+            courses_.push_back(c);
+        }
     }
 
+    std::size_t size() const { return courses_.size(); }
+
+    // Bảng id <-> handle
+    const CourseIdTable& ids() const { return ids_; }
+
     template <class Fn>
     void for_each(Fn&& fn) const {
-        for (const auto& kv : courses) fn(kv.second);
+        for (const auto& c : courses_) fn(c);
     }
 
 private:
-    std::unordered_map<std::string, Course> courses;
+    std::deque<Course> courses_;
+    CourseIdTable ids_;
 };
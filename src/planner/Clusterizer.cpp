@@ -78,3 +78,45 @@ ClusterResult Clusterizer::buildClusters(
 
     return result;
 }
+
+// Như trên nhưng theo idx: visited / courseToCluster là mảng, không hash chuỗi
+ClusterIndexResult Clusterizer::buildClusters(
+    const vector<int>& credits,
+    const vector<vector<int>>& coreqs,
+    int maxQuota
+) {
+    const int V = (int)credits.size();
+    ClusterIndexResult result;
+    result.clusterOf.assign(V, -1);
+    vector<int> st;
+
+    for (int start = 0; start < V; start++) {
+        if (result.clusterOf[start] != -1) continue;
+        const int clusterId = (int)result.clusterCredits.size();
+        int totalCredits = 0;
+
+        st.push_back(start);
+        while (!st.empty()) {
+            const int cur = st.back();
+            st.pop_back();
+            if (result.clusterOf[cur] != -1) continue;
+            result.clusterOf[cur] = clusterId;
+            totalCredits += credits[cur];
+            if (cur < (int)coreqs.size()) {
+                for (int nxt : coreqs[cur]) {
+                    if (result.clusterOf[nxt] == -1) st.push_back(nxt);
+                }
+            }
+        }
+
+        result.clusterCredits.push_back(totalCredits);
+        if (totalCredits > maxQuota) {
+            result.feasible = false;
+            result.note += "Cluster " + to_string(clusterId) +
+                           " vượt quota (" + to_string(totalCredits) +
+                           " > " + to_string(maxQuota) + "). ";
+        }
+    }
+
+    return result;
+}
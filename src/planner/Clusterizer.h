@@ -13,6 +13,14 @@ struct ClusterResult {
     string note;
 };
 
+// Bản theo idx (handle của CourseGraph / CourseIdTable)
+struct ClusterIndexResult {
+    vector<int> clusterOf;       // idx môn -> cụm
+    vector<int> clusterCredits;
+    bool feasible = true;
+    string note;
+};
+
 class Clusterizer {
 public:
     ClusterResult buildClusters(
@@ -21,6 +29,14 @@ public:
         int maxQuota
     );
 
+    // credits[u] = tín chỉ của môn u; coreqs[u] = các idx coreq của u (đi một chiều
+    // như bản string). Cụm được đánh số theo idx nhỏ nhất của thành viên.
+    ClusterIndexResult buildClusters(
+        const vector<int>& credits,
+        const vector<vector<int>>& coreqs,
+        int maxQuota
+    );
+
 private:
     void dfsCluster(
         const string& course,
@@ -0,0 +1,117 @@
+#include "ComponentPlanner.h"
+#include "LongestPathDag.h"
+#include "graph/TopoSort.h"
+#include "graph/WeakComponents.h"
+#include "util/ThreadPool.h"
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+using namespace std;
+
+namespace {
+
+// Kết quả xếp cục bộ của một thành phần (idx cục bộ)
+struct ComponentPlan {
+    vector<int> order;      // topo cục bộ
+    vector<int> earliest;
+    vector<int> term;       // 0 = kế hoạch con không xếp được
+    int span = 0;           // earliest term lớn nhất
+    long long credits = 0;
+    exception_ptr error;
+};
+
+} // namespace
+
+PlanResult assignTermsByComponents(const CourseGraph& g,
+                                   const vector<int>& creditsByIdx,
+                                   const PlanConstraints& constraints,
+                                   ThreadPool& pool) {
+    const int V = g.V;
+    if ((int)creditsByIdx.size() != V) {
+        throw runtime_error("ComponentPlanner: size mismatch");
+    }
+    const int T = constraints.numTerms;
+    if (T <= 0) {
+        throw runtime_error("ComponentPlanner: constraints.numTerms must be > 0");
+    }
+
+    ComponentDecomposition comps = findWeakComponents(g);
+    vector<ComponentPlan> plans(comps.count);
+
+    // 1) Song song: mỗi thành phần tự topo + earliest + greedy
+    pool.parallelFor(comps.count, 1, [&](int b, int e, int) {
+        for (int c = b; c < e; c++) {
+            ComponentPlan& p = plans[c];
+            try {
+                const vector<int>& mem = comps.members[c];
+                CourseGraph sub = inducedSubgraph(g, mem);
+                TopoResult topo;
+                p.earliest = topoAndEarliestTerms(sub, topo).termByIdx;
+                if (!topo.success) {
+                    throw runtime_error("ComponentPlanner: component has cycle (topo failed)");
+                }
+                vector<int> credits(mem.size());
+                for (size_t i = 0; i < mem.size(); i++) credits[i] = creditsByIdx[mem[i]];
+                p.term = assignTermsGreedy(sub, topo, p.earliest, credits, constraints).termOfIdx;
+                p.order = move(topo.order);
+                p.span = *max_element(p.earliest.begin(), p.earliest.end());
+                p.credits = accumulate(credits.begin(), credits.end(), 0LL);
+            } catch (...) {
+                p.error = current_exception();
+            }
+        }
+    });
+    for (const auto& p : plans) {
+        if (p.error) rethrow_exception(p.error);
+    }
+
+    // 2) Tuần tự: gộp dưới quota chung, thành phần "dài" trước
+    vector<int> byPriority(comps.count);
+    iota(byPriority.begin(), byPriority.end(), 0);
+    sort(byPriority.begin(), byPriority.end(), [&](int a, int b) {
+        if (plans[a].span != plans[b].span) return plans[a].span > plans[b].span;
+        if (plans[a].credits != plans[b].credits) return plans[a].credits > plans[b].credits;
+        return a < b;
+    });
+
+    PlanResult res;
+    res.termOfIdx.assign(V, 0);
+    vector<int> termCredits(T + 1, 0);
+    for (int c : byPriority) {
+        const ComponentPlan& p = plans[c];
+        const vector<int>& mem = comps.members[c];
+        for (int lu : p.order) {
+            const int u = mem[lu];
+            int t = p.term[lu] > 0 ? p.term[lu] : p.earliest[lu];
+            bool blocked = false;
+            for (int pre : g.radj[u]) {
+                if (res.termOfIdx[pre] == 0) { blocked = true; break; }
+                t = max(t, res.termOfIdx[pre] + 1);
+            }
+            const uint64_t mask = g.offered(u);
+            t = nextOfferedTerm(mask, t);
+            while (!blocked && t != 0 && t <= T && termCredits[t] + creditsByIdx[u] > constraints.maxCreditsPerTerm) {
+                t = nextOfferedTerm(mask, t + 1);
+            }
+            if (blocked || t == 0 || t > T) {
+                if (res.ok) {
+                    res.notes.push_back("Infeasible: out of terms while respecting quotas. Consider increasing numTerms or maxCreditsPerTerm.");
+                }
+                res.ok = false;
+                continue;
+            }
+            res.termOfIdx[u] = t;
+            termCredits[t] += creditsByIdx[u];
+        }
+    }
+    return res;
+}
+
+PlanResult assignTermsByComponents(const CourseGraph& g,
+                                   const vector<int>& creditsByIdx,
+                                   const PlanConstraints& constraints,
+                                   int numThreads) {
+    ThreadPool pool(numThreads);
+    return assignTermsByComponents(g, creditsByIdx, constraints, pool);
+}
@@ -0,0 +1,28 @@
+/*
+ * ComponentPlanner
+ * Xếp kỳ theo từng thành phần liên thông yếu (graph/WeakComponents.h):
+ * 1) Song song, mỗi thành phần một task trên ThreadPool: dựng đồ thị con,
+ *    topoSort, computeEarliestTerms, assignTermsGreedy với constraints chung.
+ * 2) Tuần tự: gộp các kế hoạch con vào một bảng tín chỉ chung. Thành phần có
+ *    chuỗi dài hơn được gộp trước; mỗi môn giữ kỳ của kế hoạch con nếu kỳ đó
+ *    còn quota, không thì lùi sang kỳ kế tiếp còn chỗ (luôn sau mọi prereq).
+ *
+ * Kết quả chỉ phụ thuộc input, không phụ thuộc số thread.
+ * Ném std::runtime_error nếu có chu trình hoặc kích thước input không khớp.
+ */
+#pragma once
+#include <vector>
+#include "TermAssigner.h"
+#include "../graph/CourseGraph.h"
+#include "../model/PlanConstraints.h"
+
+class ThreadPool;
+
+PlanResult assignTermsByComponents(const CourseGraph& g,
+                                   const std::vector<int>& creditsByIdx,
+                                   const PlanConstraints& constraints,
+                                   ThreadPool& pool);
+PlanResult assignTermsByComponents(const CourseGraph& g,
+                                   const std::vector<int>& creditsByIdx,
+                                   const PlanConstraints& constraints,
+                                   int numThreads = 0);
@@ -0,0 +1,122 @@
+#include "CoreqPlanner.h"
+#include "Clusterizer.h"
+#include "LongestPathDag.h"
+#include <algorithm>
+#include <stdexcept>
+using namespace std;
+
+CoreqClusterGraph buildCoreqClusterGraph(const CourseGraph& g,
+                                         const Curriculum& cur,
+                                         const vector<int>& creditsByIdx,
+                                         int maxCreditsPerTerm) {
+    const int V = g.V;
+    if ((int)creditsByIdx.size() != V) {
+        throw runtime_error("CoreqPlanner: size mismatch");
+    }
+
+    // Clusterizer chỉ đi theo chiều khai báo -> thêm chiều ngược cho mọi cặp coreq
+    vector<vector<int>> coreqs(V);
+    for (int u = 0; u < V; u++) {
+        for (const auto& other : cur.get(g.idxToId[u]).corequisite) {
+            const CourseHandle v = g.idToIdx.find(other);
+            if (v == CourseIdTable::npos || (int)v == u) continue;
+            coreqs[u].push_back((int)v);
+            coreqs[v].push_back(u);
+        }
+    }
+    Clusterizer clusterizer;
+    ClusterIndexResult clusters = clusterizer.buildClusters(creditsByIdx, coreqs, maxCreditsPerTerm);
+
+    // Cụm đã được đánh số theo idx nhỏ nhất của thành viên
+    CoreqClusterGraph res;
+    res.clusterOf = move(clusters.clusterOf);
+    res.credits = move(clusters.clusterCredits);
+    const int C = (int)res.credits.size();
+    res.members.assign(C, {});
+    for (int u = 0; u < V; u++) res.members[res.clusterOf[u]].push_back(u);
+
+    // id cụm tổng hợp "#c<c>" không trùng id môn nào; tên thành viên chỉ dùng cho thông báo
+    vector<string> ids(C), names(C);
+    vector<uint64_t> mask(C, 0);
+    for (int c = 0; c < C; c++) {
+        ids[c] = "#c" + to_string(c);
+        bool restricted = false;
+        uint64_t common = ~uint64_t(0);
+        for (int u : res.members[c]) {
+            names[c] += names[c].empty() ? "{" : ", ";
+            names[c] += g.idxToId[u];
+            if (g.offered(u) != 0) {
+                restricted = true;
+                common &= g.offered(u);
+            }
+        }
+        names[c] += '}';
+        mask[c] = restricted ? common : 0;
+        if (res.credits[c] > maxCreditsPerTerm) {
+            res.problems.push_back("Coreq cluster " + names[c] + " needs " + to_string(res.credits[c]) +
+                                   " credits, more than maxCreditsPerTerm (" + to_string(maxCreditsPerTerm) + ").");
+        }
+        if (restricted && common == 0) {
+            res.problems.push_back("Coreq cluster " + names[c] + " has no offered term shared by all its courses.");
+        }
+    }
+
+    // Cạnh giữa các cụm (bỏ trùng); cạnh trong cụm = prereq và coreq mâu thuẫn
+    vector<pair<int, int>> edges;
+    for (int v = 0; v < V; v++) {
+        for (int u : g.adj[v]) {
+            const int a = res.clusterOf[v], b = res.clusterOf[u];
+            if (a == b) {
+                res.problems.push_back("Coreq cluster " + names[a] + " contains prerequisite " +
+                                       g.idxToId[v] + " -> " + g.idxToId[u] + ".");
+            } else {
+                edges.emplace_back(a, b);
+            }
+        }
+    }
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+    vector<int> from(edges.size()), to(edges.size());
+    for (size_t e = 0; e < edges.size(); e++) {
+        from[e] = edges[e].first;
+        to[e] = edges[e].second;
+    }
+    res.graph.buildFromEdges(move(ids), from, to);
+    res.graph.offeredMask = move(mask);
+    return res;
+}
+
+PlanResult assignTermsWithCoreqClusters(const CourseGraph& g,
+                                        const Curriculum& cur,
+                                        const vector<int>& creditsByIdx,
+                                        const PlanConstraints& constraints) {
+    if (!constraints.enforceCoreqTogether) {
+        TopoResult topo;
+        EarliestTerms earliest = topoAndEarliestTerms(g, topo);
+        return assignTermsGreedy(g, topo, earliest.termByIdx, creditsByIdx, constraints);
+    }
+
+    CoreqClusterGraph cg = buildCoreqClusterGraph(g, cur, creditsByIdx, constraints.maxCreditsPerTerm);
+    PlanResult res;
+    res.termOfIdx.assign(g.V, 0);
+
+    // Kiểm tra trước khi xếp: không có vòng sửa cụm bị tách
+    TopoResult topo;
+    EarliestTerms earliest = topoAndEarliestTerms(cg.graph, topo);
+    if (!topo.success) {
+        cg.problems.push_back("Coreq clusters form a prerequisite cycle.");
+    }
+    if (!cg.problems.empty()) {
+        res.ok = false;
+        res.notes = move(cg.problems);
+        return res;
+    }
+
+    PlanResult clusterPlan = assignTermsGreedy(cg.graph, topo, earliest.termByIdx, cg.credits, constraints);
+    for (int u = 0; u < g.V; u++) {
+        res.termOfIdx[u] = clusterPlan.termOfIdx[cg.clusterOf[u]];
+    }
+    res.ok = clusterPlan.ok;
+    res.notes = move(clusterPlan.notes);
+    return res;
+}
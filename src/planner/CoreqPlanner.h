@@ -0,0 +1,40 @@
+/*
+ * CoreqPlanner
+ * Xếp kỳ khi constraints.enforceCoreqTogether: mỗi cụm coreq (Clusterizer,
+ * coreq coi như quan hệ hai chiều) thành một siêu đỉnh của đồ thị xếp lịch:
+ * - tín chỉ = tổng tín chỉ các môn trong cụm
+ * - cạnh vào = hợp các cạnh prereq từ ngoài cụm (bỏ trùng)
+ * - offeredMask = giao các mask khác 0 của thành viên
+ * Cả cụm được xếp một lần vào cùng một kỳ nên không bao giờ bị tách.
+ *
+ * Cụm không khả thi bị phát hiện trước khi xếp (plan.ok = false, notes ghi lý do):
+ * tổng tín chỉ > maxCreditsPerTerm, có prereq nằm trong chính cụm, các thành
+ * viên không có kỳ mở chung, hoặc cụm tạo chu trình prereq.
+ * enforceCoreqTogether = false thì chạy pipeline thường trên g.
+ */
+#pragma once
+#include <string>
+#include <vector>
+#include "TermAssigner.h"
+#include "../graph/CourseGraph.h"
+#include "../model/Curriculum.h"
+#include "../model/PlanConstraints.h"
+
+struct CoreqClusterGraph {
+    CourseGraph graph;                      // đỉnh c = cụm c; id tổng hợp "#c<c>"
+    std::vector<int> clusterOf;             // idx môn -> cụm
+    std::vector<std::vector<int>> members;  // cụm -> idx môn (tăng dần)
+    std::vector<int> credits;               // tổng tín chỉ mỗi cụm
+    std::vector<std::string> problems;      // lý do cụm không khả thi (rỗng = ổn)
+};
+
+// Cụm được đánh số theo idx nhỏ nhất của thành viên (ổn định giữa các lần chạy)
+CoreqClusterGraph buildCoreqClusterGraph(const CourseGraph& g,
+                                         const Curriculum& cur,
+                                         const std::vector<int>& creditsByIdx,
+                                         int maxCreditsPerTerm);
+
+PlanResult assignTermsWithCoreqClusters(const CourseGraph& g,
+                                        const Curriculum& cur,
+                                        const std::vector<int>& creditsByIdx,
+                                        const PlanConstraints& constraints);
@@ -0,0 +1,154 @@
+#include "CurriculumDiff.h"
+#include "LongestPathDag.h"
+#include "TermAssigner.h"
+#include "graph/TopoSort.h"
+#include <algorithm>
+#include <set>
+using namespace std;
+
+namespace {
+
+set<string> prereqSet(const Course& c) {
+    return set<string>(c.prerequisite.begin(), c.prerequisite.end());
+}
+
+bool sameAttributes(const Course& a, const Course& b) {
+    return a.name == b.name && a.credits == b.credits && a.corequisite == b.corequisite &&
+           a.elective_groups == b.elective_groups && a.offered_terms == b.offered_terms &&
+           a.track == b.track;
+}
+
+bool edgeLess(const PrereqEdge& a, const PrereqEdge& b) {
+    return a.course != b.course ? a.course < b.course : a.prereq < b.prereq;
+}
+
+} // namespace
+
+CurriculumDiff diffCurricula(const Curriculum& before, const Curriculum& after) {
+    CurriculumDiff d;
+    before.for_each([&](const Course& c) {
+        if (!after.exists(c.id)) {
+            d.removed.push_back(c.id);
+            for (const auto& p : prereqSet(c)) d.removedEdges.push_back({p, c.id});
+        }
+    });
+    after.for_each([&](const Course& c) {
+        const set<string> now = prereqSet(c);
+        if (!before.exists(c.id)) {
+            d.added.push_back(c.id);
+            for (const auto& p : now) d.addedEdges.push_back({p, c.id});
+            return;
+        }
+        const Course& old = before.get(c.id);
+        if (!sameAttributes(old, c)) d.changed.push_back(c.id);
+        if (old.credits != c.credits) d.creditChanged.push_back(c.id);
+        const set<string> was = prereqSet(old);
+        for (const auto& p : now) {
+            if (!was.count(p)) d.addedEdges.push_back({p, c.id});
+        }
+        for (const auto& p : was) {
+            if (!now.count(p)) d.removedEdges.push_back({p, c.id});
+        }
+    });
+    sort(d.added.begin(), d.added.end());
+    sort(d.removed.begin(), d.removed.end());
+    sort(d.changed.begin(), d.changed.end());
+    sort(d.creditChanged.begin(), d.creditChanged.end());
+    sort(d.addedEdges.begin(), d.addedEdges.end(), edgeLess);
+    sort(d.removedEdges.begin(), d.removedEdges.end(), edgeLess);
+    return d;
+}
+
+unordered_set<string> affectedCourses(const CurriculumDiff& diff, const CourseGraph& after) {
+    unordered_set<string> res(diff.removed.begin(), diff.removed.end());
+
+    vector<char> seen(after.V, 0);
+    vector<int> st;
+    auto seed = [&](const string& id) {
+        const CourseHandle h = after.idToIdx.find(id);
+        if (h == CourseIdTable::npos || seen[h]) return;
+        seen[h] = 1;
+        st.push_back((int)h);
+    };
+    for (const auto& id : diff.added) seed(id);
+    for (const auto& id : diff.changed) seed(id);
+    for (const auto& e : diff.addedEdges) seed(e.course);
+    for (const auto& e : diff.removedEdges) seed(e.course);
+
+    while (!st.empty()) {
+        const int u = st.back();
+        st.pop_back();
+        res.insert(after.idxToId[u]);
+        for (int v : after.adj[u]) {
+            if (!seen[v]) { seen[v] = 1; st.push_back(v); }
+        }
+    }
+    return res;
+}
+
+ReplanStats replanAffected(vector<StudentPlan>& plans,
+                           const CurriculumDiff& diff,
+                           const Curriculum& after,
+                           const CourseGraph& afterGraph) {
+    ReplanStats stats;
+    if (diff.empty()) {
+        stats.carried = (int)plans.size();
+        return stats;
+    }
+    const unordered_set<string> region = affectedCourses(diff, afterGraph);
+
+    for (auto& plan : plans) {
+        bool touched = false;
+        for (const auto& kv : plan.termById) {
+            if (region.count(kv.first)) { touched = true; break; }
+        }
+        if (!touched) {
+            stats.carried++;
+            continue;
+        }
+        stats.replanned++;
+
+        // Tập môn mới: môn cũ còn tồn tại + mọi prereq (bắc cầu) còn thiếu
+        vector<char> inPlan(afterGraph.V, 0);
+        vector<int> st;
+        for (const auto& kv : plan.termById) {
+            const CourseHandle h = afterGraph.idToIdx.find(kv.first);
+            if (h != CourseIdTable::npos && !inPlan[h]) { inPlan[h] = 1; st.push_back((int)h); }
+        }
+        while (!st.empty()) {
+            const int u = st.back();
+            st.pop_back();
+            for (int p : afterGraph.radj[u]) {
+                if (!inPlan[p]) { inPlan[p] = 1; st.push_back(p); }
+            }
+        }
+        vector<string> ids;
+        for (int u = 0; u < afterGraph.V; u++) {
+            if (inPlan[u]) ids.push_back(afterGraph.idxToId[u]);
+        }
+        sort(ids.begin(), ids.end()); // thứ tự nạp ổn định
+
+        vector<Course> picked;
+        picked.reserve(ids.size());
+        for (const auto& id : ids) picked.push_back(after.get(id));
+        Curriculum sub(move(picked));
+        CourseGraph g;
+        g.build(sub);
+        TopoResult topo;
+        EarliestTerms et = topoAndEarliestTerms(g, topo);
+        plan.termById.clear();
+        plan.notes.clear();
+        if (!topo.success) {
+            plan.ok = false;
+            plan.notes.push_back("Infeasible: new curriculum has a prerequisite cycle.");
+            continue;
+        }
+        vector<int> credits(g.V);
+        for (int u = 0; u < g.V; u++) credits[u] = sub.get(g.idxToId[u]).credits;
+        PlanResult r = assignTermsGreedy(g, topo, et.termByIdx, credits, plan.constraints);
+        plan.ok = r.ok;
+        plan.notes = move(r.notes);
+        for (int u = 0; u < g.V; u++) plan.termById[g.idxToId[u]] = r.termOfIdx[u];
+    }
+    return stats;
+}
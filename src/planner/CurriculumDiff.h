@@ -0,0 +1,64 @@
+/*
+ * CurriculumDiff
+ * So sánh hai snapshot Curriculum (vd catalog năm cũ / năm mới) và chỉ xếp
+ * lại những kế hoạch bị ảnh hưởng.
+ *
+ * - diffCurricula: môn thêm / xoá / đổi thuộc tính (credits, coreq, offered
+ *   terms, ...), cạnh prereq thêm / bớt; mọi danh sách sắp theo id.
+ * - affectedCourses: vùng ảnh hưởng trên đồ thị mới = môn thêm, môn đổi, môn
+ *   có prereq thay đổi và mọi hậu duệ của chúng; cộng thêm các môn đã xoá.
+ * - replanAffected: kế hoạch có môn nằm trong vùng đó thì chạy lại topo ->
+ *   earliest term -> assignTermsGreedy trên curriculum mới (bỏ môn đã xoá, thêm
+ *   prereq mới còn thiếu); kế hoạch khác giữ nguyên, không đụng tới.
+ */
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../graph/CourseGraph.h"
+#include "../model/Curriculum.h"
+#include "../model/PlanConstraints.h"
+
+struct PrereqEdge {
+    std::string prereq;
+    std::string course;
+};
+
+struct CurriculumDiff {
+    std::vector<std::string> added;
+    std::vector<std::string> removed;
+    std::vector<std::string> changed;        // đổi thuộc tính ngoài prereq (gồm cả credits)
+    std::vector<std::string> creditChanged;  // tập con của changed
+    std::vector<PrereqEdge> addedEdges;
+    std::vector<PrereqEdge> removedEdges;
+
+    bool empty() const {
+        return added.empty() && removed.empty() && changed.empty() &&
+               addedEdges.empty() && removedEdges.empty();
+    }
+};
+
+CurriculumDiff diffCurricula(const Curriculum& before, const Curriculum& after);
+
+// after phải được build từ curriculum mới của diff
+std::unordered_set<std::string> affectedCourses(const CurriculumDiff& diff, const CourseGraph& after);
+
+// Kế hoạch của một sinh viên: tập môn cần xếp + kỳ đã xếp (theo id, vì idx đổi giữa các snapshot)
+struct StudentPlan {
+    std::string studentId;
+    PlanConstraints constraints;
+    std::unordered_map<std::string, int> termById;
+    bool ok = true;
+    std::vector<std::string> notes;
+};
+
+struct ReplanStats {
+    int replanned = 0;
+    int carried = 0;
+};
+
+ReplanStats replanAffected(std::vector<StudentPlan>& plans,
+                           const CurriculumDiff& diff,
+                           const Curriculum& after,
+                           const CourseGraph& afterGraph);
@@ -0,0 +1,310 @@
+#include "ExactAssigner.h"
+#include "LongestPathDag.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+using namespace std;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+constexpr size_t kMaxMemo = size_t(1) << 20; // số trạng thái ghi nhớ tối đa mỗi pha
+constexpr long long kInf = LLONG_MAX;
+
+struct WordsHash {
+    size_t operator()(const vector<uint64_t>& w) const {
+        uint64_t h = 1469598103934665603ull;
+        for (uint64_t x : w) {
+            h ^= x;
+            h *= 1099511628211ull;
+            h ^= h >> 29;
+        }
+        return (size_t)h;
+    }
+};
+
+// Tổng bình phương nhỏ nhất khi chia R tín chỉ cho m kỳ (chia đều nhất có thể)
+long long balancedSquares(long long R, int m) {
+    if (m <= 0) return R > 0 ? kInf : 0;
+    const long long q = R / m, r = R % m;
+    return r * (q + 1) * (q + 1) + (m - r) * q * q;
+}
+
+class BranchAndBound {
+public:
+    BranchAndBound(const CourseGraph& g, const TopoResult& topo, const vector<int>& credits,
+                   const PlanConstraints& c, const ExactOptions& opt)
+        : g_(g), credits_(credits), maxCredits_(c.maxCreditsPerTerm), numTerms_(c.numTerms),
+          deadline_(Clock::now() + chrono::duration_cast<Clock::duration>(
+                                        chrono::duration<double, milli>(opt.timeBudgetMs))) {
+        const int V = g.V;
+        // height[u]: số môn trên chuỗi dài nhất bắt đầu từ u
+        height_.assign(V, 1);
+        for (int i = V - 1; i >= 0; --i) {
+            const int u = topo.order[i];
+            for (int s : g.adj[u]) height_[u] = max(height_[u], height_[s] + 1);
+        }
+        term_.assign(V, 0);
+        placed_.assign((V + 63) / 64 + 1, 0); // word cuối dành cho k
+        for (int u = 0; u < V; ++u) remaining_ += credits[u];
+        total_ = remaining_;
+    }
+
+    void seed(const vector<int>& termOf) {
+        int used = 0;
+        vector<long long> load(numTerms_ + 1, 0);
+        for (int u = 0; u < g_.V; ++u) {
+            used = max(used, termOf[u]);
+            load[termOf[u]] += credits_[u];
+        }
+        long long sq = 0;
+        for (int t = 1; t <= used; ++t) sq += load[t] * load[t];
+        bestTerms_ = used;
+        bestSq_ = sq;
+        bestTermOf_ = termOf;
+    }
+
+    int rootLowerBound() { return termsLowerBound(1); }
+
+    // Pha 1: ít kỳ nhất. true nếu duyệt hết (kết quả đã tối ưu / chứng minh vô nghiệm)
+    bool minimiseTerms() {
+        phase_ = 1;
+        searchTerm(1, 0);
+        return !timedOut_;
+    }
+
+    // Pha 2: tổng bình phương nhỏ nhất với đúng bestTerms kỳ
+    bool minimiseLoad() {
+        phase_ = 2;
+        memo_.clear();
+        searchTerm(1, 0);
+        return !timedOut_;
+    }
+
+    bool found() const { return !bestTermOf_.empty(); }
+    int bestTerms() const { return bestTerms_; }
+    long long bestSquares() const { return bestSq_; }
+    long long total() const { return total_; }
+    const vector<int>& bestTermOf() const { return bestTermOf_; }
+    long long nodes() const { return nodes_; }
+
+private:
+    bool stop() {
+        if (timedOut_) return true;
+        if ((++ticks_ & 255) == 0 && Clock::now() >= deadline_) timedOut_ = true;
+        return timedOut_;
+    }
+
+    int limit() const {
+        if (phase_ == 2) return bestTerms_;
+        return found() ? min(numTerms_, bestTerms_ - 1) : numTerms_;
+    }
+
+    // Cận dưới số kỳ khi đang ở đầu kỳ k; INT_MAX nếu có môn không còn kỳ mở
+    int termsLowerBound(int k) const {
+        if (placedCount_ == g_.V) return k - 1;
+        int lb = k - 1;
+        if (maxCredits_ > 0) lb += (int)((remaining_ + maxCredits_ - 1) / maxCredits_);
+        for (int u = 0; u < g_.V; ++u) {
+            if (term_[u]) continue;
+            const int t = nextOfferedTerm(g_.offered(u), k);
+            if (t == 0) return INT_MAX;
+            lb = max(lb, t + height_[u] - 1);
+        }
+        return lb;
+    }
+
+    void place(int u, int k) {
+        term_[u] = k;
+        placed_[u >> 6] |= uint64_t(1) << (u & 63);
+        remaining_ -= credits_[u];
+        ++placedCount_;
+    }
+
+    void unplace(int u) {
+        term_[u] = 0;
+        placed_[u >> 6] &= ~(uint64_t(1) << (u & 63));
+        remaining_ += credits_[u];
+        --placedCount_;
+    }
+
+    // Trạng thái (tập đã xếp, k) đã gặp với chi phí không tệ hơn -> bỏ.
+    // Khoá luôn gồm k: cùng tập ở kỳ sớm hơn không trội được, vì nhánh chờ kỳ mở
+    // (kỳ k trống) đi qua đúng trạng thái (tập, k + 1). Pha 1 chỉ cần "đã duyệt".
+    bool dominated(int k, long long sq) {
+        const long long cost = phase_ == 1 ? 0 : sq;
+        placed_.back() = (uint64_t)k;
+        auto it = memo_.find(placed_);
+        if (it != memo_.end()) {
+            if (it->second <= cost) return true;
+            it->second = cost;
+        } else if (memo_.size() < kMaxMemo) {
+            memo_.emplace(placed_, cost);
+        }
+        return false;
+    }
+
+    void record(int used, long long sq) {
+        if (phase_ == 1 ? used < bestTerms_ || !found() : sq < bestSq_) {
+            bestTerms_ = used;
+            bestSq_ = sq;
+            bestTermOf_ = term_;
+        }
+    }
+
+    void searchTerm(int k, long long sq) {
+        if (stop()) return;
+        ++nodes_;
+        if (placedCount_ == g_.V) {
+            record(k - 1, sq);
+            return;
+        }
+        const int lim = limit();
+        if (k > lim || termsLowerBound(k) > lim) return;
+        if (phase_ == 2) {
+            const long long lb = balancedSquares(remaining_, lim - k + 1);
+            if (lb == kInf || sq + lb >= bestSq_) return;
+        }
+        if (dominated(k, sq)) return;
+
+        // Môn sẵn sàng ở kỳ k: chưa xếp, mọi prereq đã xếp (ở kỳ < k), mở ở kỳ k
+        vector<int> avail;
+        for (int u = 0; u < g_.V; ++u) {
+            if (term_[u] || nextOfferedTerm(g_.offered(u), k) != k) continue;
+            bool ready = true;
+            for (int p : g_.radj[u]) {
+                if (!term_[p]) { ready = false; break; }
+            }
+            if (ready) avail.push_back(u);
+        }
+        sort(avail.begin(), avail.end(), [&](int a, int b) {
+            if (height_[a] != height_[b]) return height_[a] > height_[b];
+            if (credits_[a] != credits_[b]) return credits_[a] > credits_[b];
+            return a < b;
+        });
+        chooseSubset(avail, 0, maxCredits_, k, sq);
+    }
+
+    // Chọn tập môn cho kỳ k (gồm / bỏ avail[i]); pha 1 chỉ nhận tập tối đại
+    void chooseSubset(const vector<int>& avail, size_t i, int room, int k, long long sq) {
+        if (stop()) return;
+        if (i == avail.size()) {
+            if (phase_ == 1) {
+                for (int u : avail) {
+                    if (term_[u] != k && credits_[u] <= room) return;
+                }
+            }
+            const long long load = maxCredits_ - room;
+            searchTerm(k + 1, sq + load * load);
+            return;
+        }
+        const int u = avail[i];
+        if (credits_[u] <= room) {
+            place(u, k);
+            chooseSubset(avail, i + 1, room - credits_[u], k, sq);
+            unplace(u);
+        }
+        chooseSubset(avail, i + 1, room, k, sq);
+    }
+
+    const CourseGraph& g_;
+    const vector<int>& credits_;
+    const int maxCredits_;
+    const int numTerms_;
+    const Clock::time_point deadline_;
+
+    vector<int> height_;
+    vector<int> term_;            // 0 = chưa xếp
+    vector<uint64_t> placed_;     // bitset môn đã xếp (+ word khoá)
+    int placedCount_ = 0;
+    long long remaining_ = 0;     // tín chỉ chưa xếp
+    long long total_ = 0;
+
+    int phase_ = 1;
+    unordered_map<vector<uint64_t>, long long, WordsHash> memo_;
+
+    int bestTerms_ = 0;
+    long long bestSq_ = kInf;
+    vector<int> bestTermOf_;
+
+    long long nodes_ = 0;
+    unsigned ticks_ = 0;
+    bool timedOut_ = false;
+};
+
+} // namespace
+
+ExactPlan assignTermsExact(const CourseGraph& g,
+                           const vector<int>& creditsByIdx,
+                           const PlanConstraints& constraints,
+                           const ExactOptions& options) {
+    const int V = g.V;
+    if ((int)creditsByIdx.size() != V) {
+        throw runtime_error("ExactAssigner: size mismatch");
+    }
+    if (constraints.numTerms <= 0) {
+        throw runtime_error("ExactAssigner: constraints.numTerms must be > 0");
+    }
+    for (int c : creditsByIdx) {
+        if (c < 0) throw runtime_error("ExactAssigner: negative credits");
+    }
+    TopoResult topo;
+    EarliestTerms earliest = topoAndEarliestTerms(g, topo);
+    if (!topo.success) {
+        throw runtime_error("ExactAssigner: graph has cycle (topo failed)");
+    }
+
+    ExactPlan res;
+    res.plan.termOfIdx.assign(V, 0);
+
+    for (int u = 0; u < V; ++u) {
+        if (creditsByIdx[u] > constraints.maxCreditsPerTerm) {
+            res.optimal = true;
+            res.plan.ok = false;
+            res.plan.notes.push_back("Infeasible: course " + g.idxToId[u] +
+                                     " has more credits than maxCreditsPerTerm.");
+            return res;
+        }
+    }
+
+    BranchAndBound bb(g, topo, creditsByIdx, constraints, options);
+    if (earliest.ok) {
+        PlanResult greedy = assignTermsGreedy(g, topo, earliest.termByIdx, creditsByIdx, constraints);
+        if (greedy.ok) bb.seed(greedy.termOfIdx);
+    }
+    res.termsLowerBound = min(bb.rootLowerBound(), constraints.numTerms + 1);
+
+    const bool termsDone = bb.minimiseTerms();
+    const bool loadDone = termsDone && bb.found() && bb.minimiseLoad();
+    res.nodes = bb.nodes();
+
+    if (!bb.found()) {
+        res.plan.ok = false;
+        res.optimal = termsDone;
+        res.plan.notes.push_back(termsDone
+            ? "Infeasible: no assignment satisfies numTerms, maxCreditsPerTerm and offered terms."
+            : "Time budget reached before a feasible plan was found. Increase the budget or relax constraints.");
+        return res;
+    }
+
+    res.plan.termOfIdx = bb.bestTermOf();
+    res.termsUsed = bb.bestTerms();
+    res.loadSquares = bb.bestSquares();
+    if (termsDone) res.termsLowerBound = res.termsUsed;
+    res.loadSquaresLowerBound = loadDone ? res.loadSquares : balancedSquares(bb.total(), res.termsUsed);
+    res.optimal = loadDone;
+    if (!termsDone) {
+        res.gap = (double)(res.termsUsed - res.termsLowerBound) / res.termsUsed;
+    } else if (!loadDone && res.loadSquares > 0) {
+        res.gap = (double)(res.loadSquares - res.loadSquaresLowerBound) / res.loadSquares;
+    }
+    if (!res.optimal) {
+        res.plan.notes.push_back("Time budget reached: plan may be suboptimal (gap " +
+                                 to_string((int)(res.gap * 100 + 0.5)) + "%).");
+    }
+    return res;
+}
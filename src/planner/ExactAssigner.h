@@ -0,0 +1,47 @@
+/*
+ * ExactAssigner
+ * Xếp kỳ tối ưu bằng branch-and-bound, theo thứ tự mục tiêu:
+ *   1) ít kỳ nhất (kỳ cuối có môn)
+ *   2) tải lệch ít nhất: tổng bình phương tín chỉ mỗi kỳ (cùng tổng tín chỉ và
+ *      cùng số kỳ thì nhỏ nhất <=> phương sai nhỏ nhất)
+ * dưới ràng buộc prereq, maxCreditsPerTerm, numTerms và offeredMask.
+ *
+ * Duyệt từng kỳ, mỗi nút chọn một tập môn sẵn sàng cho kỳ k. Cắt nhánh bằng:
+ * - cận đường găng: nextOfferedTerm(kỳ mở) + chiều cao chuỗi phía sau - 1
+ * - cận tín chỉ: ceil(tín chỉ còn lại / maxCreditsPerTerm)
+ * - trội (pha 1): chỉ thử tập tối đại; đưa môn sẵn sàng lên sớm không bao giờ
+ *   làm tăng số kỳ
+ * - ghi nhớ trạng thái (tập môn đã xếp, k): gặp lại (pha 1) hoặc gặp lại với
+ *   tổng bình phương không nhỏ hơn (pha 2) thì bỏ
+ * Lời giải ban đầu lấy từ assignTermsGreedy.
+ *
+ * Hết timeBudgetMs thì trả lời giải tốt nhất đang có; gap là khoảng cách tương
+ * đối tới cận dưới của mục tiêu đang tối ưu (0 khi optimal). minCreditsPerTerm
+ * và coreq không được xét (giống assignTermsGreedy).
+ * Ném std::runtime_error nếu có chu trình hoặc kích thước input không khớp.
+ */
+#pragma once
+#include <vector>
+#include "TermAssigner.h"
+#include "../graph/CourseGraph.h"
+#include "../model/PlanConstraints.h"
+
+struct ExactOptions {
+    double timeBudgetMs = 200.0;
+};
+
+struct ExactPlan {
+    PlanResult plan;
+    bool optimal = false;        // đã chứng minh tối ưu cả hai mục tiêu (hoặc vô nghiệm)
+    int termsUsed = 0;
+    int termsLowerBound = 0;
+    long long loadSquares = 0;   // tổng bình phương tín chỉ các kỳ
+    long long loadSquaresLowerBound = 0;
+    double gap = 0.0;
+    long long nodes = 0;         // số nút đã duyệt
+};
+
+ExactPlan assignTermsExact(const CourseGraph& g,
+                           const std::vector<int>& creditsByIdx,
+                           const PlanConstraints& constraints,
+                           const ExactOptions& options = {});
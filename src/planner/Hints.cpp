@@ -1,4 +1,6 @@
 #include "Hints.h"
+#include <algorithm>
+#include <numeric>
 
 using namespace std;
 
@@ -60,3 +62,28 @@ vector<HintNote> Hints::analyze(
 
     return notes;
 }
+
+// xếp môn theo số môn bị chặn nếu trượt (giảm dần, hoà thì theo id)
+vector<HintNote> Hints::rankByImpact(
+    const vector<string>& ids,
+    const vector<int>& descendants,
+    int topK
+){
+    vector<int> idx(min(ids.size(), descendants.size()));
+    iota(idx.begin(), idx.end(), 0);
+    sort(idx.begin(), idx.end(), [&](int a, int b) {
+        if (descendants[a] != descendants[b]) return descendants[a] > descendants[b];
+        return ids[a] < ids[b];
+    });
+
+    vector<HintNote> notes;
+    for (int i : idx) {
+        if ((int)notes.size() >= topK || descendants[i] <= 0) break;
+        notes.push_back(makeHint(
+            "Nên ưu tiên môn " + ids[i] + ": mở khoá " + to_string(descendants[i]) + " môn phía sau.",
+            "prioritize_course",
+            ids[i]
+        ));
+    }
+    return notes;
+}
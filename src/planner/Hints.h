@@ -19,4 +19,12 @@ public:
         bool electiveConflict,
         bool preferLightLoad
     );
+
+    // Gợi ý ưu tiên topK môn mở khoá nhiều môn phía sau nhất
+    // (descendants[i]: số hậu duệ bắc cầu của ids[i], vd ReachCounts::descendants)
+    static vector<HintNote> rankByImpact(
+        const vector<string>& ids,
+        const vector<int>& descendants,
+        int topK
+    );
 };
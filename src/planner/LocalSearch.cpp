@@ -0,0 +1,215 @@
+#include "LocalSearch.h"
+#include "util/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+using namespace std;
+
+namespace {
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// xorshift64*: nhỏ, nhanh, cùng seed cho cùng dãy trên mọi nền tảng
+struct Rng {
+    uint64_t s;
+    explicit Rng(uint64_t seed) : s(seed ? seed : 0x9e3779b97f4a7c15ull) {}
+    uint64_t next() {
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        return s * 0x2545f4914f6cdd1dull;
+    }
+    int below(int n) { return (int)(next() % (uint64_t)n); }
+    double unit() { return (double)(next() >> 11) * (1.0 / 9007199254740992.0); }
+};
+
+class Chain {
+public:
+    Chain(const CourseGraph& g, const vector<int>& credits, const PlanConstraints& c, const vector<int>& start)
+        : g_(g), credits_(credits), T_(c.numTerms), maxCredits_(c.maxCreditsPerTerm),
+          term_(start), load_(T_ + 1, 0), count_(T_ + 1, 0) {
+        long long total = 0;
+        for (int u = 0; u < g.V; ++u) {
+            load_[term_[u]] += credits[u];
+            count_[term_[u]]++;
+            last_ = max(last_, term_[u]);
+            total += credits[u];
+        }
+        for (int t = 1; t <= T_; ++t) sq_ += load_[t] * load_[t];
+        weight_ = total * total + 1;
+    }
+
+    // số kỳ chiếm trọng số lớn hơn mọi tổng bình phương -> so sánh thứ tự từ điển
+    long long cost() const { return last_ * weight_ + sq_; }
+    int last() const { return last_; }
+    long long squares() const { return sq_; }
+    const vector<int>& terms() const { return term_; }
+
+    void run(Rng& rng, int iterations, double temp0, vector<int>& best, long long& bestCost) {
+        const int V = g_.V;
+        if (V == 0) return;
+        for (int it = 0; it < iterations; ++it) {
+            const double temp = temp0 * (1.0 - (double)it / iterations);
+            const int u = rng.below(V);
+            const int tu = term_[u];
+            const long long before = cost();
+            int lo, hi;
+            window(u, lo, hi);
+            if (rng.below(2) == 0) {
+                // shift
+                if (lo > hi) continue;
+                const int t = lo + rng.below(hi - lo + 1);
+                if (t == tu || !offered(u, t) || load_[t] + credits_[u] > maxCredits_) continue;
+                move(u, t);
+                if (!accept(rng, cost() - before, temp)) move(u, tu);
+            } else {
+                // swap
+                const int v = rng.below(V);
+                const int tv = term_[v];
+                if (tv == tu || tv < lo || tv > hi || !offered(u, tv) || !offered(v, tu)) continue;
+                int vlo, vhi;
+                window(v, vlo, vhi);
+                if (tu < vlo || tu > vhi) continue;
+                if (load_[tv] - credits_[v] + credits_[u] > maxCredits_ ||
+                    load_[tu] - credits_[u] + credits_[v] > maxCredits_) continue;
+                move(u, tv);
+                move(v, tu);
+                if (!accept(rng, cost() - before, temp)) {
+                    move(v, tv);
+                    move(u, tu);
+                }
+            }
+            if (cost() < bestCost) {
+                bestCost = cost();
+                best = term_;
+            }
+        }
+    }
+
+private:
+    // Kỳ hợp lệ của u khi giữ nguyên các môn khác: sau mọi prereq, trước mọi môn cần u
+    void window(int u, int& lo, int& hi) const {
+        lo = 1;
+        hi = T_;
+        for (int p : g_.radj[u]) lo = max(lo, term_[p] + 1);
+        for (int s : g_.adj[u]) hi = min(hi, term_[s] - 1);
+    }
+
+    bool offered(int u, int t) const { return nextOfferedTerm(g_.offered(u), t) == t; }
+
+    static bool accept(Rng& rng, long long delta, double temp) {
+        if (delta <= 0) return true;
+        if (temp <= 0) return false;
+        return rng.unit() < exp(-(double)delta / temp);
+    }
+
+    void move(int u, int to) {
+        const int from = term_[u];
+        const long long c = credits_[u];
+        sq_ -= load_[from] * load_[from] + load_[to] * load_[to];
+        load_[from] -= c;
+        load_[to] += c;
+        sq_ += load_[from] * load_[from] + load_[to] * load_[to];
+        count_[from]--;
+        count_[to]++;
+        term_[u] = to;
+        if (to > last_) last_ = to;
+        while (last_ > 0 && count_[last_] == 0) --last_;
+    }
+
+    const CourseGraph& g_;
+    const vector<int>& credits_;
+    const int T_;
+    const int maxCredits_;
+    vector<int> term_;
+    vector<long long> load_;
+    vector<int> count_;
+    int last_ = 0;
+    long long sq_ = 0;
+    long long weight_ = 1;
+};
+
+void checkStart(const CourseGraph& g, const vector<int>& credits, const PlanConstraints& c, const PlanResult& start) {
+    if ((int)credits.size() != g.V || (int)start.termOfIdx.size() != g.V) {
+        throw runtime_error("LocalSearch: size mismatch");
+    }
+    vector<long long> load(c.numTerms + 1, 0);
+    for (int u = 0; u < g.V; ++u) {
+        const int t = start.termOfIdx[u];
+        if (t < 1 || t > c.numTerms || nextOfferedTerm(g.offered(u), t) != t) {
+            throw runtime_error("LocalSearch: start plan places " + g.idxToId[u] + " outside an offered term");
+        }
+        for (int p : g.radj[u]) {
+            if (start.termOfIdx[p] >= t) {
+                throw runtime_error("LocalSearch: start plan violates prerequisite of " + g.idxToId[u]);
+            }
+        }
+        load[t] += credits[u];
+    }
+    for (int t = 1; t <= c.numTerms; ++t) {
+        if (load[t] > c.maxCreditsPerTerm) {
+            throw runtime_error("LocalSearch: start plan exceeds maxCreditsPerTerm in term " + to_string(t));
+        }
+    }
+}
+
+struct ChainOutcome {
+    vector<int> term;
+    long long cost = 0;
+};
+
+} // namespace
+
+LocalSearchResult improvePlanLocalSearch(const CourseGraph& g,
+                                         const vector<int>& creditsByIdx,
+                                         const PlanConstraints& constraints,
+                                         const PlanResult& start,
+                                         const LocalSearchOptions& options,
+                                         ThreadPool& pool) {
+    checkStart(g, creditsByIdx, constraints, start);
+
+    const Chain initial(g, creditsByIdx, constraints, start.termOfIdx);
+    const double temp0 = options.temperature * (double)constraints.maxCreditsPerTerm * constraints.maxCreditsPerTerm;
+    const int chains = max(0, options.chains);
+
+    vector<ChainOutcome> out(chains);
+    pool.parallelFor(chains, 1, [&](int b, int e, int) {
+        for (int c = b; c < e; ++c) {
+            Chain chain(g, creditsByIdx, constraints, start.termOfIdx);
+            Rng rng(splitmix64(options.seed ^ splitmix64((uint64_t)c + 1)));
+            out[c].term = start.termOfIdx;
+            out[c].cost = chain.cost();
+            chain.run(rng, options.iterations, temp0, out[c].term, out[c].cost);
+        }
+    });
+
+    LocalSearchResult res;
+    res.plan = start;
+    long long bestCost = initial.cost();
+    for (int c = 0; c < chains; ++c) {
+        if (out[c].cost < bestCost) {
+            bestCost = out[c].cost;
+            res.bestChain = c;
+        }
+    }
+    if (res.bestChain >= 0) res.plan.termOfIdx = out[res.bestChain].term;
+    const Chain chosen(g, creditsByIdx, constraints, res.plan.termOfIdx);
+    res.termsUsed = chosen.last();
+    res.loadSquares = chosen.squares();
+    return res;
+}
+
+LocalSearchResult improvePlanLocalSearch(const CourseGraph& g,
+                                         const vector<int>& creditsByIdx,
+                                         const PlanConstraints& constraints,
+                                         const PlanResult& start,
+                                         const LocalSearchOptions& options,
+                                         int numThreads) {
+    ThreadPool pool(numThreads);
+    return improvePlanLocalSearch(g, creditsByIdx, constraints, start, options, pool);
+}
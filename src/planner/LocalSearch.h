@@ -0,0 +1,53 @@
+/*
+ * LocalSearch
+ * Cải thiện một kế hoạch đã khả thi bằng simulated annealing đa khởi đầu:
+ * mục tiêu là ít kỳ hơn (kỳ cuối có môn), rồi tải đều hơn (tổng bình phương
+ * tín chỉ mỗi kỳ 1..termsUsed, cùng số kỳ thì tương đương phương sai).
+ *
+ * Nước đi:
+ * - shift: dời một môn sang kỳ khác trong cửa sổ (kỳ prereq muộn nhất, kỳ môn
+ *   sau sớm nhất), kỳ đó phải mở (offeredMask) và còn quota
+ * - swap: đổi kỳ hai môn, mỗi môn phải nằm trong cửa sổ của mình ở kỳ mới
+ * Mỗi nước kiểm tra O(deg) trên adj / radj và tính delta mục tiêu O(1).
+ *
+ * chains chuỗi độc lập chạy trên ThreadPool; chuỗi c dùng seed suy ra từ
+ * (seed, c) nên kết quả chỉ phụ thuộc seed, không phụ thuộc số thread hay thứ
+ * tự chạy. Hoà thì lấy chuỗi có chỉ số nhỏ hơn.
+ *
+ * Ném std::runtime_error nếu start không đầy đủ / vi phạm prereq, quota, kỳ mở.
+ */
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "TermAssigner.h"
+#include "../graph/CourseGraph.h"
+#include "../model/PlanConstraints.h"
+
+class ThreadPool;
+
+struct LocalSearchOptions {
+    int chains = 8;
+    int iterations = 20000;     // số nước thử mỗi chuỗi
+    std::uint64_t seed = 1;
+    double temperature = 0.1;   // nhiệt độ đầu, theo đơn vị maxCreditsPerTerm^2; nguội dần về 0
+};
+
+struct LocalSearchResult {
+    PlanResult plan;
+    int termsUsed = 0;
+    long long loadSquares = 0;
+    int bestChain = -1;         // -1: không chuỗi nào tốt hơn start
+};
+
+LocalSearchResult improvePlanLocalSearch(const CourseGraph& g,
+                                         const std::vector<int>& creditsByIdx,
+                                         const PlanConstraints& constraints,
+                                         const PlanResult& start,
+                                         const LocalSearchOptions& options,
+                                         ThreadPool& pool);
+LocalSearchResult improvePlanLocalSearch(const CourseGraph& g,
+                                         const std::vector<int>& creditsByIdx,
+                                         const PlanConstraints& constraints,
+                                         const PlanResult& start,
+                                         const LocalSearchOptions& options = {},
+                                         int numThreads = 0);
@@ -36,6 +36,10 @@ Truy vết đường lý do (đường dài nhất tới một môn), dùng đ
 
 AC: Trả chuỗi môn từ gốc → target khớp phụ thuộc dài nhất.*/
 #include "LongestPathDag.h"
+#include "../graph/SmallGraph.h"
+#include "../util/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
 
 EarliestTerms computeEarliestTerms(const CourseGraph& g, const TopoResult& topo) {
     if (!topo.success) {
@@ -45,13 +49,111 @@ EarliestTerms computeEarliestTerms(const CourseGraph& g, const TopoResult& topo)
     EarliestTerms res;
     res.termByIdx.assign(V, 1); // sources & isolated nodes = 1 (policy)
 
-    // Relax edges in topological order: u -> v implies term[v] >= term[u] + 1
+    // Pull over reverse CSR in topological order: term[u] = max(term[p] + 1) over prereqs p
     for (int u : topo.order) {
-        for (int v : g.adj[u]) {
-            if (res.termByIdx[v] < res.termByIdx[u] + 1) {
-                res.termByIdx[v] = res.termByIdx[u] + 1;
+        int t = res.termByIdx[u];
+        for (int p : g.radj[u]) {
+            if (t < res.termByIdx[p] + 1) {
+                t = res.termByIdx[p] + 1;
             }
         }
+        const int offered = nextOfferedTerm(g.offered(u), t);
+        if (offered == 0) {
+            res.ok = false;
+        } else {
+            t = offered;
+        }
+        res.termByIdx[u] = t;
+    }
+    return res;
+}
+
+// số node mỗi khối khi chia một tầng cho pool (giống topoSortParallel)
+static constexpr int kLevelGrain = 512;
+
+EarliestTerms computeEarliestTermsParallel(const CourseGraph& g, const TopoResult& topo, ThreadPool& pool) {
+    if (topo.levelStart.empty()) {
+        return computeEarliestTerms(g, topo);
+    }
+    if (!topo.success) {
+        throw std::runtime_error("EarliestTerms: graph has cycle (topo failed)");
+    }
+    EarliestTerms res;
+    res.termByIdx.assign(g.V, 1);
+    int* term = res.termByIdx.data();
+    std::atomic<bool> ok{true};
+    for (size_t k = 0; k + 1 < topo.levelStart.size(); ++k) {
+        const int* level = topo.order.data() + topo.levelStart[k];
+        const int n = topo.levelStart[k + 1] - topo.levelStart[k];
+        pool.parallelFor(n, kLevelGrain, [&](int b, int e, int) {
+            for (int i = b; i < e; ++i) {
+                const int u = level[i];
+                int t = 1;
+                for (int p : g.radj[u]) {
+                    if (t < term[p] + 1) {
+                        t = term[p] + 1;
+                    }
+                }
+                const int offered = nextOfferedTerm(g.offered(u), t);
+                if (offered == 0) {
+                    ok.store(false, std::memory_order_relaxed);
+                } else {
+                    t = offered;
+                }
+                term[u] = t;
+            }
+        });
+    }
+    res.ok = ok.load();
+    return res;
+}
+
+EarliestTerms computeEarliestTermsParallel(const CourseGraph& g, const TopoResult& topo, int numThreads) {
+    ThreadPool pool(numThreads);
+    return computeEarliestTermsParallel(g, topo, pool);
+}
+
+EarliestTerms topoAndEarliestTerms(const CourseGraph& g, TopoResult& topo) {
+    EarliestTerms res;
+    if (!analyzeSmall(g, topo, res.termByIdx, &res.ok)) {
+        topo = topoSort(g);
+        if (topo.success) return computeEarliestTerms(g, topo);
+    }
+    if (!topo.success) {
+        res.ok = false;
+        res.termByIdx.clear();
+    }
+    return res;
+}
+
+TermWindows computeTermWindows(const CourseGraph& g, const TopoResult& topo, int numTerms) {
+    TermWindows res;
+    EarliestTerms earliest = computeEarliestTerms(g, topo);
+    res.ok = earliest.ok;
+    res.earliestTermByIdx = std::move(earliest.termByIdx);
+
+    // Pass ngược: latest[u] = min(numTerms, min(latest[s] - 1)) trên các môn s cần u
+    const int V = g.V;
+    res.latestTermByIdx.assign(V, numTerms);
+    res.slackByIdx.assign(V, 0);
+    for (int i = V - 1; i >= 0; --i) {
+        const int u = topo.order[i];
+        int t = res.latestTermByIdx[u];
+        for (int s : g.adj[u]) {
+            if (t > res.latestTermByIdx[s] - 1) {
+                t = res.latestTermByIdx[s] - 1;
+            }
+        }
+        t = prevOfferedTerm(g.offered(u), t);
+        res.latestTermByIdx[u] = t;
+        res.slackByIdx[u] = t - res.earliestTermByIdx[u];
+        if (res.slackByIdx[u] < 0) {
+            res.ok = false;
+        }
     }
     return res;
 }
+
+std::vector<std::int64_t> topoKeySlack(const TermWindows& w) {
+    return std::vector<std::int64_t>(w.slackByIdx.begin(), w.slackByIdx.end());
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include "../graph/CourseGraph.h"
@@ -7,4 +8,37 @@ struct EarliestTerms {
     bool ok = true;
     std::vector<int> termByIdx;
 };
-EarliestTerms computeEarliestTerms(const CourseGraph& g, const TopoResult& topo);
\ No newline at end of file
+// Môn có g.offeredMask được đẩy tới kỳ mở gần nhất (nextOfferedTerm); nếu
+// không còn kỳ mở nào thì giữ kỳ theo prereq và ok = false.
+EarliestTerms computeEarliestTerms(const CourseGraph& g, const TopoResult& topo);
+
+// Như trên nhưng theo sóng tầng: các node của một tầng (topo.levelStart, từ
+// topoSortParallel) tự kéo max(term prereq) + 1 qua radj song song trên pool.
+// Mỗi node chỉ ghi ô của chính nó và chỉ đọc tầng trước, nên không cần atomic;
+// kết quả giống hệt bản tuần tự. topo không có levelStart -> chạy tuần tự.
+EarliestTerms computeEarliestTermsParallel(const CourseGraph& g, const TopoResult& topo, ThreadPool& pool);
+EarliestTerms computeEarliestTermsParallel(const CourseGraph& g, const TopoResult& topo, int numThreads = 0);
+
+// Topo + earliest term trong một lượt. V <= 256 dùng SmallGraph (bitset, không
+// cấp phát theo cạnh, áp cả offeredMask), còn lại topoSort + computeEarliestTerms.
+// Đây là đường mặc định cho planner / snapshot / UI. Không ném:
+// có chu trình thì topo.success = false và trả ok = false, termByIdx rỗng.
+EarliestTerms topoAndEarliestTerms(const CourseGraph& g, TopoResult& topo);
+
+// Cửa sổ kỳ của mỗi môn khi phải tốt nghiệp trong numTerms kỳ:
+// - earliestTermByIdx: như computeEarliestTerms (pass xuôi)
+// - latestTermByIdx: kỳ muộn nhất vẫn kịp mọi môn phía sau (pass ngược trên cùng
+//   topo), lùi về kỳ mở gần nhất (prevOfferedTerm); 0 nếu không còn kỳ mở
+// - slackByIdx = latest - earliest; 0 = môn nằm trên đường găng
+// ok = false nếu có môn slack < 0 (chuỗi prereq dài hơn numTerms).
+struct TermWindows {
+    bool ok = true;
+    std::vector<int> earliestTermByIdx;
+    std::vector<int> latestTermByIdx;
+    std::vector<int> slackByIdx;
+};
+TermWindows computeTermWindows(const CourseGraph& g, const TopoResult& topo, int numTerms);
+
+// Key cho topoSortByKey: môn ít slack ra trước, nên assignTermsGreedy (duyệt theo
+// topo.order) lấp quota bằng môn đường găng trước.
+std::vector<std::int64_t> topoKeySlack(const TermWindows& w);
@@ -0,0 +1,28 @@
+#include "ProvisionalPlan.h"
+#include "LongestPathDag.h"
+#include "graph/TopoSort.h"
+using namespace std;
+
+ProvisionalPlan assignTermsDroppingCycles(const CourseGraph& g,
+                                          const vector<int>& creditsByIdx,
+                                          const PlanConstraints& constraints) {
+    ProvisionalPlan res;
+    res.dropped = findFeedbackArcSet(g);
+
+    const CourseGraph* work = &g;
+    CourseGraph relaxed;
+    if (!res.dropped.empty()) {
+        relaxed = g;
+        removeArcs(relaxed, res.dropped);
+        work = &relaxed;
+    }
+
+    TopoResult topo;
+    EarliestTerms earliest = topoAndEarliestTerms(*work, topo);
+    res.plan = assignTermsGreedy(*work, topo, earliest.termByIdx, creditsByIdx, constraints);
+    for (const auto& a : res.dropped) {
+        res.plan.notes.push_back("Provisionally dropped prerequisite " + g.idxToId[a.prereq] +
+                                 " -> " + g.idxToId[a.course] + " to break a cycle. Fix the curriculum data.");
+    }
+    return res;
+}
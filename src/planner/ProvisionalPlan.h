@@ -0,0 +1,23 @@
+/*
+ * ProvisionalPlan
+ * Chế độ xếp kỳ khi curriculum còn chu trình (vd import từ hệ thống cũ):
+ * tìm tập cạnh phản hồi (graph/FeedbackArcSet.h), bỏ tạm các cạnh đó trên một
+ * bản sao của g, rồi chạy topo -> earliest term -> assignTermsGreedy như bình thường.
+ * Mỗi cạnh bị bỏ được ghi vào dropped và vào plan.notes để người dùng sửa sau.
+ * g không chu trình thì kết quả giống hệt pipeline thường, dropped rỗng.
+ */
+#pragma once
+#include <vector>
+#include "TermAssigner.h"
+#include "../graph/CourseGraph.h"
+#include "../graph/FeedbackArcSet.h"
+#include "../model/PlanConstraints.h"
+
+struct ProvisionalPlan {
+    PlanResult plan;
+    std::vector<FeedbackArc> dropped;
+};
+
+ProvisionalPlan assignTermsDroppingCycles(const CourseGraph& g,
+                                          const std::vector<int>& creditsByIdx,
+                                          const PlanConstraints& constraints);
@@ -1,6 +1,8 @@
 #include "TermAssigner.h"
+#include "LongestPathDag.h"
 #include <stdexcept>
 #include <algorithm>
+#include <queue>
 using namespace std;
 
 PlanResult assignTermsGreedy(const CourseGraph& g,
@@ -25,16 +27,7 @@ PlanResult assignTermsGreedy(const CourseGraph& g,
 
     vector<int> termCredits(T + 1, 0); // 1..T
     int currentTerm = 1;
-    // ---- tie-break: sort candidates by earliestTerm (asc), then out-degree (desc), stable on topo ----
-    vector<int> outdeg(g.V, 0);
-    for (int u = 0; u < g.V; ++u) outdeg[u] = (int)g.adj[u].size();
-
-    vector<int> order = topo.order;
-    stable_sort(order.begin(), order.end(), [&](int a, int b) {
-        if (earliestTermByIdx[a] != earliestTermByIdx[b])
-            return earliestTermByIdx[a] < earliestTermByIdx[b];
-        return outdeg[a] > outdeg[b];
-    });
+    // priority-driven placement lives in assignTermsListScheduling
     for (int u : topo.order) {
         int credits = creditsByIdx[u];
         if (credits < 0) {
@@ -48,14 +41,21 @@ PlanResult assignTermsGreedy(const CourseGraph& g,
         // also respect currentTerm progression
         if (t < currentTerm) t = currentTerm;
 
-        // if this course has specific offered_terms in constraints (optional), you could adjust t to the next offered term >= t here.
+        // prereqs may have been pushed past their earliest term by quotas
+        for (int p : g.radj[u]) {
+            if (t <= res.termOfIdx[p]) t = res.termOfIdx[p] + 1;
+        }
+
+        // jump to offered terms only (mask bit t-1 = term t); 0 = none left
+        const uint64_t mask = g.offered(u);
+        t = nextOfferedTerm(mask, t);
 
         // try to place in a feasible term respecting max credits
-        while (t <= T && termCredits[t] + credits > constraints.maxCreditsPerTerm) {
-            ++t;
+        while (t != 0 && t <= T && termCredits[t] + credits > constraints.maxCreditsPerTerm) {
+            t = nextOfferedTerm(mask, t + 1);
         }
 
-        if (t > T) {
+        if (t == 0 || t > T) {
             res.ok = false;
             res.notes.push_back("Infeasible: out of terms while respecting quotas. Consider increasing numTerms or maxCreditsPerTerm.");
             // leave unassigned (0) for this and remaining; or break early
@@ -64,6 +64,8 @@ PlanResult assignTermsGreedy(const CourseGraph& g,
 
         res.termOfIdx[u] = t;
         termCredits[t] += credits;
+        // a course pinned to a later offered term does not drag the others along
+        if (mask != 0) continue;
         // advance currentTerm if we filled this term close to quota (simple heuristic: if cannot fit any 1-credit further, you might choose to advance)
         if (termCredits[t] >= constraints.maxCreditsPerTerm) {
             currentTerm = t + 1;
@@ -73,3 +75,74 @@ PlanResult assignTermsGreedy(const CourseGraph& g,
     }
     return res;
 }
+
+PlanResult assignTermsListScheduling(const CourseGraph& g,
+                                     const vector<int>& creditsByIdx,
+                                     const PlanConstraints& constraints) {
+    const int V = g.V;
+    if ((int)creditsByIdx.size() != V) {
+        throw runtime_error("TermAssigner: size mismatch");
+    }
+    const int T = constraints.numTerms;
+    if (T <= 0) {
+        throw runtime_error("TermAssigner: constraints.numTerms must be > 0");
+    }
+    // computeTermWindows tự tính earliest, chỉ cần một topo order
+    const TopoResult topo = topoSort(g);
+    if (!topo.success) {
+        throw runtime_error("TermAssigner: topo failed (cycle present)");
+    }
+    const TermWindows windows = computeTermWindows(g, topo, T);
+
+    // tail[u]: number of courses on the longest chain starting at u
+    vector<int> tail(V, 1);
+    for (int i = V - 1; i >= 0; --i) {
+        const int u = topo.order[i];
+        for (int s : g.adj[u]) tail[u] = max(tail[u], tail[s] + 1);
+    }
+
+    // top of heap = longer remaining chain, then less slack, then more credits, then lower idx
+    auto lower = [&](int a, int b) {
+        if (tail[a] != tail[b]) return tail[a] < tail[b];
+        if (windows.slackByIdx[a] != windows.slackByIdx[b]) return windows.slackByIdx[a] > windows.slackByIdx[b];
+        if (creditsByIdx[a] != creditsByIdx[b]) return creditsByIdx[a] < creditsByIdx[b];
+        return a > b;
+    };
+    priority_queue<int, vector<int>, decltype(lower)> ready(lower);
+
+    PlanResult res;
+    res.termOfIdx.assign(V, 0);
+    vector<int> termCredits(T + 1, 0);
+    vector<int> pending = g.indeg;   // prereqs not placed yet
+    vector<int> after(V, 1);         // 1 + latest prereq term
+    for (int u = 0; u < V; ++u) {
+        if (creditsByIdx[u] < 0) {
+            throw runtime_error("TermAssigner: negative credits");
+        }
+        if (pending[u] == 0) ready.push(u);
+    }
+
+    while (!ready.empty()) {
+        const int u = ready.top();
+        ready.pop();
+        const uint64_t mask = g.offered(u);
+        int t = nextOfferedTerm(mask, after[u]);
+        while (t != 0 && t <= T && termCredits[t] + creditsByIdx[u] > constraints.maxCreditsPerTerm) {
+            t = nextOfferedTerm(mask, t + 1);
+        }
+        if (t == 0 || t > T) {
+            if (res.ok) {
+                res.notes.push_back("Infeasible: out of terms while respecting quotas. Consider increasing numTerms or maxCreditsPerTerm.");
+            }
+            res.ok = false;
+            continue; // successors never become ready and stay unassigned
+        }
+        res.termOfIdx[u] = t;
+        termCredits[t] += creditsByIdx[u];
+        for (int s : g.adj[u]) {
+            after[s] = max(after[s], t + 1);
+            if (--pending[s] == 0) ready.push(s);
+        }
+    }
+    return res;
+}
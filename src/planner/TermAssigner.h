@@ -13,9 +13,18 @@ struct PlanResult {
 };
 
 // Greedy heuristic: iterate in topo order, place each course at max(earliestTerm, currentTerm).
+// Courses with g.offeredMask only land on offered terms (next set bit via ctz).
 // If quota exceeded, advance to next term until fits. If > numTerms -> infeasible.
 PlanResult assignTermsGreedy(const CourseGraph& g,
                              const TopoResult& topo,
                              const std::vector<int>& earliestTermByIdx, // size V, >=1
                              const std::vector<int>& creditsByIdx,      // size V, >=0
                              const PlanConstraints& constraints);
+
+// List scheduler: a course enters a priority heap once all its prereqs are placed.
+// Pop order: longest remaining prereq chain, then least slack (computeTermWindows),
+// then most credits, then lowest idx. Each course goes to the first term after its
+// prereqs that is offered and still has quota. O((V + E) log V + V * numTerms).
+PlanResult assignTermsListScheduling(const CourseGraph& g,
+                                     const std::vector<int>& creditsByIdx,
+                                     const PlanConstraints& constraints);
@@ -0,0 +1,40 @@
+/*
+ * Thao tác bit trên word 64 bit, dùng chung cho bitset / mask kỳ mở.
+ * GCC/Clang dùng __builtin_*, MSVC dùng intrinsic tương ứng trong <intrin.h>.
+ */
+#pragma once
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Vị trí bit 1 thấp nhất (ctz); x != 0
+inline int lowestBit(std::uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+// Vị trí bit 1 cao nhất (63 - clz); x != 0
+inline int highestBit(std::uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanReverse64(&i, x);
+    return (int)i;
+#else
+    return 63 - __builtin_clzll(x);
+#endif
+}
+
+// Số bit 1
+inline int popCount(std::uint64_t x) {
+#ifdef _MSC_VER
+    return (int)__popcnt64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
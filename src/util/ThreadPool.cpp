@@ -0,0 +1,74 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int numThreads) {
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (numThreads <= 0) numThreads = 1;
+    }
+    for (int w = 1; w < numThreads; ++w) {
+        workers_.emplace_back([this, w] { workerLoop(w); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : workers_) t.join();
+}
+
+void ThreadPool::runChunks(int worker) {
+    for (;;) {
+        const int begin = next_.fetch_add(grain_, std::memory_order_relaxed);
+        if (begin >= n_) return;
+        (*job_)(begin, std::min(begin + grain_, n_), worker);
+    }
+}
+
+void ThreadPool::workerLoop(int worker) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lk(m_);
+            wake_.wait(lk, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        runChunks(worker);
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(int n, int grain, const RangeFn& fn) {
+    if (n <= 0) return;
+    if (grain < 1) grain = 1;
+
+    // Việc nhỏ hoặc không có worker: chạy luôn trên thread gọi
+    if (workers_.empty() || n <= grain) {
+        fn(0, n, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        job_ = &fn;
+        n_ = n;
+        grain_ = grain;
+        next_.store(0, std::memory_order_relaxed);
+        active_ = static_cast<int>(workers_.size());
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    runChunks(0);
+
+    std::unique_lock<std::mutex> lk(m_);
+    done_.wait(lk, [&] { return active_ == 0; });
+    job_ = nullptr;
+}
@@ -0,0 +1,48 @@
+/*
+ * ThreadPool
+ * - Pool cố định gồm (numThreads - 1) worker + chính thread gọi.
+ * - parallelFor(n, grain, fn): chia [0, n) thành các khối liên tiếp cỡ grain,
+ *   gọi fn(begin, end, worker) song song và chặn tới khi xong hết.
+ * - worker nằm trong [0, size()), dùng để ghi vào buffer riêng mỗi thread.
+ *
+ * fn không được ném exception (pool không chuyển tiếp exception về thread gọi).
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    using RangeFn = std::function<void(int begin, int end, int worker)>;
+
+    explicit ThreadPool(int numThreads = 0); // 0 -> hardware_concurrency
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+    void parallelFor(int n, int grain, const RangeFn& fn);
+
+private:
+    void workerLoop(int worker);
+    void runChunks(int worker);
+
+    std::vector<std::thread> workers_;
+    std::mutex m_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const RangeFn* job_ = nullptr;
+    int n_ = 0;
+    int grain_ = 1;
+    std::atomic<int> next_{0};
+    int active_ = 0;
+    std::uint64_t generation_ = 0;
+    bool stop_ = false;
+};
@@ -0,0 +1,183 @@
+#include "DotExport.h"
+#include <stdexcept>
+#include <unordered_map>
+using namespace std;
+
+namespace {
+
+// Bảng màu cố định (ColorBrewer Set3), track thứ k dùng màu k % 12
+const char* const kPalette[] = {
+    "#8dd3c7", "#ffffb3", "#bebada", "#fb8072", "#80b1d3", "#fdb462",
+    "#b3de69", "#fccde5", "#d9d9d9", "#bc80bd", "#ccebc5", "#ffed6f",
+};
+constexpr int kPaletteSize = sizeof(kPalette) / sizeof(kPalette[0]);
+
+void checkOptions(const CourseGraph& g, const GraphExportOptions& opt) {
+    if (opt.focus >= g.V) {
+        throw runtime_error("DotExport: focus index out of range");
+    }
+    if ((opt.termByIdx && (int)opt.termByIdx->size() != g.V) ||
+        (opt.trackByIdx && (int)opt.trackByIdx->size() != g.V) ||
+        (opt.creditsByIdx && (int)opt.creditsByIdx->size() != g.V)) {
+        throw runtime_error("DotExport: option vector size mismatch");
+    }
+}
+
+// keep[u] = 1 nếu u được xuất
+vector<char> selectNodes(const CourseGraph& g, const GraphExportOptions& opt) {
+    if (opt.focus < 0) return vector<char>(g.V, 1);
+    vector<char> keep(g.V, 0);
+    keep[opt.focus] = 1;
+    vector<int> st;
+    auto walk = [&](const CsrAdjacency& dir) {
+        st.assign(1, opt.focus);
+        while (!st.empty()) {
+            const int u = st.back();
+            st.pop_back();
+            for (int v : dir[u]) {
+                if (!keep[v]) { keep[v] = 1; st.push_back(v); }
+            }
+        }
+    };
+    if (opt.ancestors) walk(g.radj);
+    if (opt.descendants) walk(g.adj);
+    return keep;
+}
+
+// Màu theo track (chỉ số trong kPalette), -1 nếu không tô
+vector<int> trackColors(const CourseGraph& g, const GraphExportOptions& opt, const vector<char>& keep) {
+    vector<int> color(g.V, -1);
+    if (!opt.trackByIdx) return color;
+    unordered_map<string, int> byTrack;
+    for (int u = 0; u < g.V; u++) {
+        const string& t = (*opt.trackByIdx)[u];
+        if (!keep[u] || t.empty()) continue;
+        auto it = byTrack.emplace(t, (int)byTrack.size()).first;
+        color[u] = it->second % kPaletteSize;
+    }
+    return color;
+}
+
+void putDotString(ostream& os, const string& s) {
+    for (char c : s) {
+        if (c == '"' || c == '\\') os.put('\\');
+        os.put(c);
+    }
+}
+
+void putXml(ostream& os, const string& s) {
+    for (char c : s) {
+        switch (c) {
+            case '&': os << "&amp;"; break;
+            case '<': os << "&lt;"; break;
+            case '>': os << "&gt;"; break;
+            case '"': os << "&quot;"; break;
+            case '\'': os << "&apos;"; break;
+            default: os.put(c);
+        }
+    }
+}
+
+void writeDotNode(ostream& os, const CourseGraph& g, const GraphExportOptions& opt,
+                  const vector<int>& color, int u, const char* indent) {
+    os << indent << 'n' << u << " [label=\"";
+    putDotString(os, g.idxToId[u]);
+    if (opt.creditsByIdx) os << "\\n(" << (*opt.creditsByIdx)[u] << ')';
+    os << '"';
+    if (color[u] >= 0) os << ", fillcolor=\"" << kPalette[color[u]] << '"';
+    os << "];\n";
+}
+
+} // namespace
+
+void writeDot(ostream& os, const CourseGraph& g, const GraphExportOptions& opt) {
+    checkOptions(g, opt);
+    const vector<char> keep = selectNodes(g, opt);
+    const vector<int> color = trackColors(g, opt, keep);
+
+    os << "digraph Curriculum {\n"
+       << "  rankdir=LR;\n"
+       << "  node [shape=box, style=filled, fillcolor=\"#ffffff\"];\n";
+
+    if (opt.termByIdx) {
+        // Gom node theo kỳ bằng counting sort (chỉ mảng int, không chuỗi)
+        const vector<int>& term = *opt.termByIdx;
+        int maxTerm = 0;
+        for (int u = 0; u < g.V; u++) {
+            if (keep[u] && term[u] > maxTerm) maxTerm = term[u];
+        }
+        vector<int> start(maxTerm + 2, 0);
+        for (int u = 0; u < g.V; u++) {
+            if (keep[u] && term[u] > 0) start[term[u] + 1]++;
+        }
+        for (int t = 1; t <= maxTerm; t++) start[t + 1] += start[t];
+        vector<int> byTerm(start[maxTerm + 1]);
+        vector<int> cursor(start);
+        for (int u = 0; u < g.V; u++) {
+            if (keep[u] && term[u] > 0) byTerm[cursor[term[u]]++] = u;
+        }
+        for (int t = 1; t <= maxTerm; t++) {
+            if (start[t] == start[t + 1]) continue;
+            os << "  subgraph cluster_t" << t << " {\n"
+               << "    label=\"Term " << t << "\";\n";
+            for (int i = start[t]; i < start[t + 1]; i++) writeDotNode(os, g, opt, color, byTerm[i], "    ");
+            os << "  }\n";
+        }
+        // node chưa có kỳ (0) nằm ngoài cluster
+        for (int u = 0; u < g.V; u++) {
+            if (keep[u] && term[u] <= 0) writeDotNode(os, g, opt, color, u, "  ");
+        }
+    } else {
+        for (int u = 0; u < g.V; u++) {
+            if (keep[u]) writeDotNode(os, g, opt, color, u, "  ");
+        }
+    }
+
+    for (int u = 0; u < g.V; u++) {
+        if (!keep[u]) continue;
+        for (int v : g.adj[u]) {
+            if (keep[v]) os << "  n" << u << " -> n" << v << ";\n";
+        }
+    }
+    os << "}\n";
+}
+
+void writeGraphML(ostream& os, const CourseGraph& g, const GraphExportOptions& opt) {
+    checkOptions(g, opt);
+    const vector<char> keep = selectNodes(g, opt);
+    const vector<int> color = trackColors(g, opt, keep);
+
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+       << "  <key id=\"label\" for=\"node\" attr.name=\"label\" attr.type=\"string\"/>\n";
+    if (opt.creditsByIdx) os << "  <key id=\"credits\" for=\"node\" attr.name=\"credits\" attr.type=\"int\"/>\n";
+    if (opt.termByIdx) os << "  <key id=\"term\" for=\"node\" attr.name=\"term\" attr.type=\"int\"/>\n";
+    if (opt.trackByIdx) {
+        os << "  <key id=\"track\" for=\"node\" attr.name=\"track\" attr.type=\"string\"/>\n"
+           << "  <key id=\"color\" for=\"node\" attr.name=\"color\" attr.type=\"string\"/>\n";
+    }
+    os << "  <graph id=\"Curriculum\" edgedefault=\"directed\">\n";
+
+    for (int u = 0; u < g.V; u++) {
+        if (!keep[u]) continue;
+        os << "    <node id=\"n" << u << "\"><data key=\"label\">";
+        putXml(os, g.idxToId[u]);
+        os << "</data>";
+        if (opt.creditsByIdx) os << "<data key=\"credits\">" << (*opt.creditsByIdx)[u] << "</data>";
+        if (opt.termByIdx) os << "<data key=\"term\">" << (*opt.termByIdx)[u] << "</data>";
+        if (color[u] >= 0) {
+            os << "<data key=\"track\">";
+            putXml(os, (*opt.trackByIdx)[u]);
+            os << "</data><data key=\"color\">" << kPalette[color[u]] << "</data>";
+        }
+        os << "</node>\n";
+    }
+    for (int u = 0; u < g.V; u++) {
+        if (!keep[u]) continue;
+        for (int v : g.adj[u]) {
+            if (keep[v]) os << "    <edge source=\"n" << u << "\" target=\"n" << v << "\"/>\n";
+        }
+    }
+    os << "  </graph>\n"
+       << "</graphml>\n";
+}
@@ -0,0 +1,30 @@
+/*
+ * DotExport
+ * Ghi CourseGraph ra Graphviz DOT hoặc GraphML, ghi thẳng vào ostream
+ * (không dựng chuỗi trung gian cho từng node) để xuất được catalog 100k môn.
+ *
+ * - focus >= 0: chỉ xuất đồ thị con quanh một môn (prereq bắc cầu và/hoặc
+ *   các môn phụ thuộc), gồm mọi cạnh giữa các node được chọn.
+ * - termByIdx (vd EarliestTerms.termByIdx): DOT gom node thành cluster theo kỳ,
+ *   GraphML ghi thành thuộc tính "term".
+ * - trackByIdx: tô màu node theo track (bảng màu cố định, gán theo thứ tự gặp).
+ * - creditsByIdx: label "id\n(credits)".
+ * Các vector tuỳ chọn, nếu có phải cùng size V.
+ */
+#pragma once
+#include <ostream>
+#include <string>
+#include <vector>
+#include "graph/CourseGraph.h"
+
+struct GraphExportOptions {
+    int focus = -1;
+    bool ancestors = true;
+    bool descendants = true;
+    const std::vector<int>* termByIdx = nullptr;
+    const std::vector<std::string>* trackByIdx = nullptr;
+    const std::vector<int>* creditsByIdx = nullptr;
+};
+
+void writeDot(std::ostream& os, const CourseGraph& g, const GraphExportOptions& opt = {});
+void writeGraphML(std::ostream& os, const CourseGraph& g, const GraphExportOptions& opt = {});
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/WeakComponents.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/ComponentPlanner.h"
+#include "plan_test_helpers.h"
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+TEST(ComponentPlannerTest, DecomposesDisconnectedCurriculum)
+{
+    Course c1{"CS101", "Intro", 3, {}, {}};
+    Course c2{"CS102", "Tech", 3, {"CS101"}, {}};
+    Course c3{"CS201", "DSA", 3, {"CS102"}, {}};
+    Course c4{"MATH101", "Calc", 3, {}, {}};
+    Course c5{"PHYS101", "Phys", 4, {}, {}};
+    Course c6{"ENG101", "Eng I", 3, {}, {}};
+    Course c7{"ENG102", "Eng II", 3, {"ENG101"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4, c5, c6, c7});
+    CourseGraph g;
+    g.build(curr);
+
+    ComponentDecomposition comps = findWeakComponents(g);
+    EXPECT_EQ(comps.count, 4);
+    EXPECT_EQ(comps.compOf[g.idToIdx.at("CS101")], comps.compOf[g.idToIdx.at("CS201")]);
+    EXPECT_NE(comps.compOf[g.idToIdx.at("CS101")], comps.compOf[g.idToIdx.at("ENG102")]);
+
+    std::vector<int> credits = creditsOf(g, curr);
+    PlanResult r = assignTermsByComponents(g, credits, makeConstraints(8, 7), 3);
+    EXPECT_TRUE(r.ok);
+    expectValid(g, credits, r, makeConstraints(8, 7));
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("CS201")], 3);
+}
+
+TEST(ComponentPlannerTest, SameResultAcrossThreadCounts)
+{
+    const int n = 2000;
+    std::mt19937 rng(3);
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "D" + std::to_string(i % 20) + "_" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 1 + rng() % 4;
+        // 20 khoa độc lập: prereq chỉ trong cùng khoa
+        if (i >= 20)
+        {
+            int j = i - 20 * (1 + rng() % (i / 20));
+            a.prerequisite.push_back("D" + std::to_string(j % 20) + "_" + std::to_string(j));
+        }
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    EXPECT_EQ(findWeakComponents(g).count, 20);
+
+    std::vector<int> credits = creditsOf(g, curr);
+    PlanConstraints pc = makeConstraints(60, 200);
+    PlanResult one = assignTermsByComponents(g, credits, pc, 1);
+    PlanResult many = assignTermsByComponents(g, credits, pc, 8);
+    EXPECT_TRUE(one.ok);
+    EXPECT_EQ(one.termOfIdx, many.termOfIdx);
+    expectValid(g, credits, one, pc);
+}
+
+TEST(ComponentPlannerTest, InfeasibleAndCycle)
+{
+    Course c1{"A", "A", 5, {}, {}};
+    Course c2{"B", "B", 5, {}, {}};
+    Course c3{"C", "C", 5, {"B"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    PlanResult r = assignTermsByComponents(g, creditsOf(g, curr), makeConstraints(1, 10));
+    EXPECT_FALSE(r.ok);
+    EXPECT_FALSE(r.notes.empty());
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("C")], 0);
+
+    Course x{"X", "X", 3, {"Y"}, {}};
+    Course y{"Y", "Y", 3, {"X"}, {}};
+    Course z{"Z", "Z", 3, {}, {}};
+    Curriculum cyc = makeCurriculum({x, y, z});
+    CourseGraph gc;
+    gc.build(cyc);
+    EXPECT_THROW(assignTermsByComponents(gc, creditsOf(gc, cyc), makeConstraints(4, 10)), std::runtime_error);
+}
@@ -133,6 +133,24 @@ TEST_F(ClusterizerTest, NoCorequisites_AllSingleClusters)
     }
 }
 
+TEST_F(ClusterizerTest, IndexApi_NumbersClustersBySmallestIdx)
+{
+    // 0 - 2 cùng cụm, 1 đứng riêng, 3 - 4 cùng cụm
+    vector<int> credits = {3, 4, 1, 2, 2};
+    vector<vector<int>> coreqs = {{2}, {}, {0}, {4}, {3}};
+
+    Clusterizer clusterizer;
+    ClusterIndexResult result = clusterizer.buildClusters(credits, coreqs, 4);
+
+    EXPECT_TRUE(result.feasible);
+    EXPECT_EQ(result.clusterOf, (vector<int>{0, 1, 0, 2, 2}));
+    EXPECT_EQ(result.clusterCredits, (vector<int>{4, 4, 4}));
+
+    ClusterIndexResult tight = clusterizer.buildClusters(credits, coreqs, 3);
+    EXPECT_FALSE(tight.feasible);
+    EXPECT_NE(tight.note.find("vượt quota"), string::npos);
+}
+
 class ElectiveResolverTest : public ::testing::Test
 {
 protected:
@@ -293,4 +311,4 @@ TEST_F(ElectiveResolverTest, SelfSufficientPrereqs_Valid)
 
     EXPECT_TRUE(result.feasible);
     EXPECT_EQ(result.selectedCourses.size(), 3u);
-}
\ No newline at end of file
+}
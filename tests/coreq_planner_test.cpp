@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/CoreqPlanner.h"
+#include "plan_test_helpers.h"
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static int termOf(const CourseGraph &g, const PlanResult &r, const std::string &id)
+{
+    return r.termOfIdx[g.idToIdx.at(id)];
+}
+
+TEST(CoreqPlannerTest, PlacesClustersAtomically)
+{
+    // Chỉ CS101 khai báo LAB101 (một chiều) vẫn phải vào cùng cụm
+    Course cs101{"CS101", "Prog", 3, {}, {"LAB101"}};
+    Course lab101{"LAB101", "Lab", 1, {}, {}};
+    Course math{"MATH101", "Calc", 4, {}, {}};
+    Course cs201{"CS201", "DSA", 3, {"CS101"}, {"LAB201"}};
+    Course lab201{"LAB201", "DSA Lab", 1, {"LAB101"}, {"CS201"}};
+    Curriculum curr = makeCurriculum({math, cs101, lab101, cs201, lab201});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    CoreqClusterGraph cg = buildCoreqClusterGraph(g, curr, credits, 8);
+    EXPECT_TRUE(cg.problems.empty());
+    EXPECT_EQ(cg.graph.V, 3);
+    EXPECT_EQ(cg.clusterOf[g.idToIdx.at("CS101")], cg.clusterOf[g.idToIdx.at("LAB101")]);
+    EXPECT_EQ(cg.credits[cg.clusterOf[g.idToIdx.at("CS201")]], 4);
+    EXPECT_EQ(cg.graph.E, 1); // CS101 -> CS201 và LAB101 -> LAB201 gộp thành một cạnh
+
+    // quota 5: MATH101 (4) chiếm kỳ 1, cụm CS101+LAB101 (4) không vừa -> cả cụm sang kỳ 2
+    PlanResult r = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(6, 5, true));
+    ASSERT_TRUE(r.ok);
+    EXPECT_EQ(termOf(g, r, "CS101"), termOf(g, r, "LAB101"));
+    EXPECT_EQ(termOf(g, r, "CS201"), termOf(g, r, "LAB201"));
+    EXPECT_LT(termOf(g, r, "CS101"), termOf(g, r, "CS201"));
+}
+
+TEST(CoreqPlannerTest, SharedOfferedTerm)
+{
+    Course a{"A", "A", 3, {}, {"B"}};
+    a.offered_terms = {1, 3};
+    Course b{"B", "B", 3, {}, {"A"}};
+    b.offered_terms = {3, 4};
+    Curriculum curr = makeCurriculum({a, b});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult r = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(4, 9, true));
+    ASSERT_TRUE(r.ok);
+    EXPECT_EQ(termOf(g, r, "A"), 3);
+    EXPECT_EQ(termOf(g, r, "B"), 3);
+}
+
+TEST(CoreqPlannerTest, DetectsInfeasibleClustersBeforeSearch)
+{
+    Course a{"A", "A", 6, {}, {"B"}};
+    Course b{"B", "B", 6, {}, {"A"}};
+    Course c{"C", "C", 3, {}, {"D"}};
+    Course d{"D", "D", 3, {"C"}, {}};
+    Course e{"E", "E", 3, {}, {"F"}};
+    e.offered_terms = {3};
+    Course f{"F", "F", 3, {}, {}};
+    f.offered_terms = {4};
+    Curriculum curr = makeCurriculum({a, b, c, d, e, f});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult r = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(6, 9, true));
+    EXPECT_FALSE(r.ok);
+    ASSERT_EQ(r.notes.size(), 3u); // quota, prereq trong cụm, không có kỳ mở chung
+    for (int t : r.termOfIdx)
+        EXPECT_EQ(t, 0);
+
+    // Không bắt buộc cùng kỳ: xếp như pipeline thường
+    PlanResult loose = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(6, 9));
+    EXPECT_TRUE(loose.ok);
+    EXPECT_LT(termOf(g, loose, "C"), termOf(g, loose, "D"));
+}
+
+TEST(CoreqPlannerTest, ClusterCycleIsInfeasible)
+{
+    // A cùng kỳ B, nhưng A -> C -> B
+    Course a{"A", "A", 3, {}, {"B"}};
+    Course b{"B", "B", 3, {"C"}, {}};
+    Course c{"C", "C", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({a, b, c});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult r = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(6, 9, true));
+    EXPECT_FALSE(r.ok);
+    EXPECT_FALSE(r.notes.empty());
+}
+
+TEST(CoreqPlannerTest, ClusterIdsDoNotCollideWithCourseIds)
+{
+    // Cụm {A, B} không được trùng id với môn tên "A+B"
+    Course a{"A", "A", 3, {}, {"B"}};
+    Course b{"B", "B", 3, {}, {}};
+    Course ab{"A+B", "A plus B", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, ab});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    CoreqClusterGraph cg = buildCoreqClusterGraph(g, curr, credits, 9);
+    EXPECT_TRUE(cg.problems.empty());
+    ASSERT_EQ(cg.graph.V, 2);
+    for (int c = 0; c < cg.graph.V; c++)
+        EXPECT_EQ(cg.graph.idToIdx.find(g.idxToId[cg.members[c][0]]), CourseIdTable::npos);
+
+    PlanResult r = assignTermsWithCoreqClusters(g, curr, credits, makeConstraints(4, 6, true));
+    ASSERT_TRUE(r.ok);
+    EXPECT_EQ(termOf(g, r, "A"), termOf(g, r, "B"));
+    EXPECT_NE(termOf(g, r, "A"), termOf(g, r, "A+B"));
+}
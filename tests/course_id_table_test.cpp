@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "model/CourseIdTable.h"
+#include "model/Curriculum.h"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(CourseIdTableTest, EmptyTable)
+{
+    CourseIdTable t;
+    t.build({});
+    EXPECT_TRUE(t.empty());
+    EXPECT_EQ(t.find("CS101"), CourseIdTable::npos);
+    EXPECT_THROW(t.at("CS101"), std::out_of_range);
+}
+
+TEST(CourseIdTableTest, HandlesFollowLoadOrder)
+{
+    CourseIdTable t;
+    t.build({"CS101", "MATH101", "CS102"});
+    ASSERT_EQ(t.size(), 3u);
+    EXPECT_EQ(t.find("CS101"), 0u);
+    EXPECT_EQ(t.find("MATH101"), 1u);
+    EXPECT_EQ(t.at("CS102"), 2);
+    EXPECT_EQ(t.name(1), "MATH101");
+    EXPECT_EQ(t.count("PHYS101"), 0u);
+    EXPECT_EQ(t.find(""), CourseIdTable::npos);
+}
+
+TEST(CourseIdTableTest, RejectsDuplicateAndEmpty)
+{
+    CourseIdTable t;
+    EXPECT_THROW(t.build({"CS101", "CS102", "CS101"}), std::runtime_error);
+    EXPECT_THROW(t.build({"CS101", ""}), std::runtime_error);
+}
+
+TEST(CourseIdTableTest, LargeCatalogIsPerfect)
+{
+    const int n = 200000;
+    std::vector<std::string> ids;
+    ids.reserve(n);
+    for (int i = 0; i < n; i++)
+        ids.push_back("C" + std::to_string(i * 7919));
+    CourseIdTable t;
+    t.build(ids);
+    ASSERT_EQ(t.size(), (size_t)n);
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(t.find(ids[i]), (CourseHandle)i) << ids[i];
+    for (int i = 0; i < 1000; i++)
+        EXPECT_EQ(t.find("X" + std::to_string(i)), CourseIdTable::npos);
+}
+
+TEST(CourseIdTableTest, CurriculumSharesTableWithGraph)
+{
+    Curriculum curr;
+    curr.add(Course{"CS101", "Prog", 3, {}, {}});
+    curr.add(Course{"CS201", "DSA", 3, {"CS101"}, {}});
+    curr.add(Course{"CS101", "Prog v2", 4, {}, {}}); // thay tại chỗ, giữ handle 0
+    ASSERT_EQ(curr.size(), 2u);
+    EXPECT_EQ(curr.ids().find("CS101"), 0u);
+    EXPECT_EQ(curr.get(CourseHandle(0)).credits, 4);
+    EXPECT_EQ(curr.get("CS201").name, "DSA");
+
+    CourseGraph g;
+    g.build(curr);
+    ASSERT_EQ(g.V, 2);
+    for (int u = 0; u < g.V; u++)
+    {
+        EXPECT_EQ(g.idToIdx.find(g.idxToId[u]), (CourseHandle)u);
+        EXPECT_EQ(curr.get((CourseHandle)u).id, g.idxToId[u]);
+    }
+
+    Curriculum bulk({Course{"A", "A", 3, {}, {}}, Course{"B", "B", 3, {"A"}, {}}});
+    EXPECT_EQ(bulk.ids().find("B"), 1u);
+    EXPECT_THROW(Curriculum({Course{"A", "A", 3, {}, {}}, Course{"A", "A", 3, {}, {}}}), std::runtime_error);
+}
+
+TEST(CourseIdTableTest, AppendKeepsTableCompleteAndReferencesStable)
+{
+    CourseIdTable t;
+    t.build({"A", "B"});
+    EXPECT_EQ(t.append("B"), 1u);
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ(t.append("C" + std::to_string(i)), (CourseHandle)(i + 2));
+        ASSERT_EQ(t.find("C" + std::to_string(i / 2)), (CourseHandle)(i / 2 + 2));
+    }
+    EXPECT_EQ(t.find("A"), 0u);
+    EXPECT_EQ(t.find("X"), CourseIdTable::npos);
+    EXPECT_THROW(t.append(""), std::runtime_error);
+
+    Curriculum curr;
+    curr.add(Course{"CS101", "Prog", 3, {}, {}});
+    const Course &first = curr.get("CS101");
+    for (int i = 0; i < 1000; i++)
+        curr.add(Course{"X" + std::to_string(i), "X", 3, {}, {}});
+    curr.add(Course{"CS101", "Prog v2", 4, {}, {}});
+    EXPECT_EQ(first.credits, 4);
+    EXPECT_EQ(curr.size(), 1001u);
+    EXPECT_EQ(curr.ids().find("X999"), 1000u);
+}
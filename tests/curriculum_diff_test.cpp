@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "planner/CurriculumDiff.h"
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static PlanConstraints makeConstraints()
+{
+    PlanConstraints pc{};
+    pc.numTerms = 8;
+    pc.maxCreditsPerTerm = 9;
+    pc.minCreditsPerTerm = 1;
+    return pc;
+}
+
+class CurriculumDiffTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        before = makeCurriculum({
+            Course{"CS101", "Intro", 3, {}, {}},
+            Course{"CS102", "Tech", 3, {"CS101"}, {}},
+            Course{"CS201", "DSA", 3, {"CS102"}, {}},
+            Course{"ENG101", "Eng I", 2, {}, {}},
+            Course{"ENG102", "Eng II", 2, {"ENG101"}, {}},
+            Course{"OLD", "Legacy", 3, {}, {}},
+        });
+        // năm mới: bỏ OLD, thêm MATH101 làm prereq của CS201, CS102 đổi tín chỉ
+        after = makeCurriculum({
+            Course{"CS101", "Intro", 3, {}, {}},
+            Course{"CS102", "Tech", 4, {"CS101"}, {}},
+            Course{"CS201", "DSA", 3, {"CS102", "MATH101"}, {}},
+            Course{"ENG101", "Eng I", 2, {}, {}},
+            Course{"ENG102", "Eng II", 2, {"ENG101"}, {}},
+            Course{"MATH101", "Calc", 3, {}, {}},
+        });
+        afterGraph.build(after);
+    }
+
+    Curriculum before, after;
+    CourseGraph afterGraph;
+};
+
+TEST_F(CurriculumDiffTest, ReportsAllKindsOfChanges)
+{
+    CurriculumDiff d = diffCurricula(before, after);
+    EXPECT_EQ(d.added, std::vector<std::string>{"MATH101"});
+    EXPECT_EQ(d.removed, std::vector<std::string>{"OLD"});
+    EXPECT_EQ(d.changed, std::vector<std::string>{"CS102"});
+    EXPECT_EQ(d.creditChanged, std::vector<std::string>{"CS102"});
+    ASSERT_EQ(d.addedEdges.size(), 1u);
+    EXPECT_EQ(d.addedEdges[0].prereq, "MATH101");
+    EXPECT_EQ(d.addedEdges[0].course, "CS201");
+    EXPECT_TRUE(d.removedEdges.empty());
+    EXPECT_TRUE(diffCurricula(after, after).empty());
+
+    auto region = affectedCourses(d, afterGraph);
+    EXPECT_TRUE(region.count("CS102"));
+    EXPECT_TRUE(region.count("CS201"));
+    EXPECT_TRUE(region.count("OLD"));
+    EXPECT_FALSE(region.count("CS101"));
+    EXPECT_FALSE(region.count("ENG102"));
+}
+
+TEST_F(CurriculumDiffTest, ReplansOnlyTouchedPlans)
+{
+    StudentPlan cs{"s1", makeConstraints(), {{"CS101", 1}, {"CS102", 2}, {"CS201", 3}}};
+    StudentPlan eng{"s2", makeConstraints(), {{"ENG101", 1}, {"ENG102", 2}}};
+    eng.notes.push_back("kept");
+    StudentPlan legacy{"s3", makeConstraints(), {{"OLD", 1}, {"ENG101", 1}}};
+    std::vector<StudentPlan> plans{cs, eng, legacy};
+
+    ReplanStats st = replanAffected(plans, diffCurricula(before, after), after, afterGraph);
+    EXPECT_EQ(st.replanned, 2);
+    EXPECT_EQ(st.carried, 1);
+
+    // s1: MATH101 là prereq mới của CS201 nên được thêm vào kế hoạch
+    EXPECT_TRUE(plans[0].ok);
+    ASSERT_TRUE(plans[0].termById.count("MATH101"));
+    EXPECT_LT(plans[0].termById["MATH101"], plans[0].termById["CS201"]);
+    EXPECT_LT(plans[0].termById["CS102"], plans[0].termById["CS201"]);
+
+    // s2 không đụng vùng ảnh hưởng: giữ nguyên
+    EXPECT_EQ(plans[1].termById, eng.termById);
+    EXPECT_EQ(plans[1].notes, std::vector<std::string>{"kept"});
+
+    // s3: OLD bị xoá khỏi kế hoạch
+    EXPECT_FALSE(plans[2].termById.count("OLD"));
+    EXPECT_EQ(plans[2].termById.size(), 1u);
+}
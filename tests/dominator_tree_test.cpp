@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/DominatorTree.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "plan_test_helpers.h"
+#include <algorithm>
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+// b đạt được từ các nguồn khi bỏ node a?
+static bool reachableWithout(const CourseGraph &g, int a, int b)
+{
+    std::vector<char> seen(g.V, 0);
+    std::vector<int> st;
+    for (int u = 0; u < g.V; u++)
+        if (g.indeg[u] == 0 && u != a)
+        {
+            seen[u] = 1;
+            st.push_back(u);
+        }
+    while (!st.empty())
+    {
+        int u = st.back();
+        st.pop_back();
+        for (int v : g.adj[u])
+            if (v != a && !seen[v])
+            {
+                seen[v] = 1;
+                st.push_back(v);
+            }
+    }
+    return seen[b];
+}
+
+TEST(DominatorTreeTest, GatewayCourse)
+{
+    // INTRO là cổng bắt buộc của CAPSTONE; DS1/DS2 là hai nhánh thay thế
+    Course c1{"INTRO", "Intro", 3, {}, {}};
+    Course c2{"DS1", "DS1", 3, {"INTRO"}, {}};
+    Course c3{"DS2", "DS2", 3, {"INTRO"}, {}};
+    Course c4{"CAPSTONE", "Capstone", 3, {"DS1", "DS2"}, {}};
+    Course c5{"ART", "Art", 3, {}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4, c5});
+    CourseGraph g;
+    g.build(curr);
+    DominatorResult d = computeDominators(g);
+    ASSERT_TRUE(d.success);
+    int intro = g.idToIdx.at("INTRO"), cap = g.idToIdx.at("CAPSTONE");
+    EXPECT_EQ(d.idom[cap], intro);
+    EXPECT_EQ(d.idom[g.idToIdx.at("DS1")], intro);
+    EXPECT_EQ(d.idom[intro], -1);
+    EXPECT_EQ(d.dominatedCount[intro], 3);
+    EXPECT_EQ(d.dominatedCount[g.idToIdx.at("ART")], 0);
+    EXPECT_EQ(dominatorsOf(d, cap), std::vector<int>{intro});
+}
+
+TEST(DominatorTreeTest, MatchesBruteForce)
+{
+    Curriculum curr = randomCurriculum(150, 2, 17, true);
+    CourseGraph g;
+    g.build(curr);
+    DominatorResult d = computeDominators(g);
+    ASSERT_TRUE(d.success);
+    for (int b = 0; b < g.V; b++)
+    {
+        std::vector<int> want;
+        for (int a = 0; a < g.V; a++)
+            if (a != b && !reachableWithout(g, a, b))
+                want.push_back(a);
+        std::vector<int> got = dominatorsOf(d, b);
+        std::sort(got.begin(), got.end());
+        EXPECT_EQ(got, want) << "course " << b;
+    }
+}
+
+TEST(DominatorTreeTest, CycleAndLargeCatalog)
+{
+    Course x{"X", "X", 3, {"Y"}, {}};
+    Course y{"Y", "Y", 3, {"X"}, {}};
+    Curriculum cyc = makeCurriculum({x, y});
+    CourseGraph gc;
+    gc.build(cyc);
+    EXPECT_FALSE(computeDominators(gc).success);
+
+    Curriculum curr = randomCurriculum(100000, 3, 23, true);
+    CourseGraph g;
+    g.build(curr);
+    DominatorResult d = computeDominators(g);
+    ASSERT_TRUE(d.success);
+    for (int u = 0; u < g.V; u++)
+    {
+        if (d.idom[u] != -1)
+        {
+            ASSERT_EQ(d.depth[u], d.depth[d.idom[u]] + 1);
+        }
+    }
+}
@@ -3,6 +3,8 @@
 #include "../src/graph/CourseGraph.h"
 #include "../src/graph/TopoSort.h"
 #include "../src/planner/LongestPathDag.h"
+#include "../src/planner/TermAssigner.h"
+#include "../src/util/ThreadPool.h"
 #include <nlohmann/json.hpp>
 #include <unordered_map>
 #include <string>
@@ -10,6 +12,16 @@
 using namespace planner;
 using json = nlohmann::json;
 
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
 class EarliestTermTest : public ::testing::Test
 {
 protected:
@@ -155,4 +167,110 @@ TEST_F(EarliestTermTest, EmptyCurriculum_OK)
 
     auto earliestTerms = ::computeEarliestTerms(graph, topoResult);
     EXPECT_EQ(earliestTerms.termByIdx.size(), 0u);
-}
\ No newline at end of file
+}
+
+TEST(TermWindowsTest, LatestAndSlack)
+{
+    // A -> B -> D là đường găng (3 kỳ); C -> D và E tự do
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {}, {}};
+    Course d{"D", "D", 3, {"B", "C"}, {}};
+    Course e{"E", "E", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, c, d, e});
+    CourseGraph graph;
+    graph.build(curr);
+    auto topo = topoSort(graph);
+    TermWindows w = computeTermWindows(graph, topo, 4);
+    EXPECT_TRUE(w.ok);
+    auto at = [&](const char *id) { return graph.idToIdx.at(id); };
+    EXPECT_EQ(w.latestTermByIdx[at("A")], 2);
+    EXPECT_EQ(w.latestTermByIdx[at("B")], 3);
+    EXPECT_EQ(w.latestTermByIdx[at("C")], 3);
+    EXPECT_EQ(w.latestTermByIdx[at("D")], 4);
+    EXPECT_EQ(w.latestTermByIdx[at("E")], 4);
+    EXPECT_EQ(w.slackByIdx[at("A")], 1);
+    EXPECT_EQ(w.slackByIdx[at("C")], 2);
+    EXPECT_EQ(w.slackByIdx[at("E")], 3);
+
+    TermWindows tight = computeTermWindows(graph, topo, 3);
+    EXPECT_TRUE(tight.ok);
+    EXPECT_EQ(tight.slackByIdx[at("A")], 0);
+    EXPECT_EQ(tight.slackByIdx[at("B")], 0);
+    EXPECT_EQ(tight.slackByIdx[at("D")], 0);
+
+    TermWindows tooShort = computeTermWindows(graph, topo, 2);
+    EXPECT_FALSE(tooShort.ok);
+    EXPECT_LT(tooShort.slackByIdx[at("A")], 0);
+}
+
+TEST(TermWindowsTest, SlackKeyPutsCriticalCoursesFirst)
+{
+    // Quota 1 môn/kỳ: theo FIFO thì E chiếm kỳ 1 và B bị đẩy ra kỳ 3;
+    // ưu tiên slack đặt chuỗi găng A -> B trước
+    Course e{"E", "E", 3, {}, {}};
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({e, a, b});
+    CourseGraph graph;
+    graph.build(curr);
+    TermWindows w = computeTermWindows(graph, topoSort(graph), 3);
+    TopoResult bySlack = topoSortByKey(graph, topoKeySlack(w));
+    ASSERT_TRUE(bySlack.success);
+    EXPECT_EQ(bySlack.order[0], graph.idToIdx.at("A"));
+
+    PlanConstraints pc{};
+    pc.numTerms = 3;
+    pc.maxCreditsPerTerm = 3;
+    pc.minCreditsPerTerm = 1;
+    std::vector<int> credits(graph.V, 3);
+    PlanResult r = assignTermsGreedy(graph, bySlack, w.earliestTermByIdx, credits, pc);
+    EXPECT_TRUE(r.ok);
+    EXPECT_EQ(r.termOfIdx[graph.idToIdx.at("A")], 1);
+    EXPECT_EQ(r.termOfIdx[graph.idToIdx.at("B")], 2);
+    EXPECT_EQ(r.termOfIdx[graph.idToIdx.at("E")], 3);
+}
+
+TEST(EarliestTermParallelTest, WavefrontMatchesSequential)
+{
+    const int V = 20000;
+    std::vector<std::string> ids;
+    for (int i = 0; i < V; i++)
+        ids.push_back("W" + std::to_string(i));
+    std::vector<int> from, to;
+    unsigned x = 99;
+    for (int v = 1; v < V; v++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            x = x * 1103515245u + 12345u;
+            // prereq gần v -> nhiều tầng; thỉnh thoảng prereq xa
+            int lo = (k == 0) ? std::max(0, v - 8) : 0;
+            from.push_back(lo + (x >> 8) % (v - lo));
+            to.push_back(v);
+        }
+    }
+    CourseGraph graph;
+    graph.buildFromEdges(ids, from, to);
+
+    auto seq = ::computeEarliestTerms(graph, topoSort(graph));
+    ThreadPool pool(4);
+    TopoResult levels = topoSortParallel(graph, pool);
+    ASSERT_TRUE(levels.success);
+    ASSERT_GT(levels.levelStart.size(), 100u);
+    auto par = computeEarliestTermsParallel(graph, levels, pool);
+    EXPECT_EQ(par.termByIdx, seq.termByIdx);
+
+    // Không có levelStart -> rơi về bản tuần tự
+    EXPECT_EQ(computeEarliestTermsParallel(graph, topoSort(graph), 2).termByIdx, seq.termByIdx);
+}
+
+TEST(EarliestTermParallelTest, CycleThrows)
+{
+    CourseGraph graph;
+    graph.buildFromEdges({"A", "B", "C"}, {0, 1, 2}, {1, 2, 1});
+    ThreadPool pool(2);
+    TopoResult topo = topoSortParallel(graph, pool);
+    ASSERT_FALSE(topo.success);
+    EXPECT_THROW(computeEarliestTermsParallel(graph, topo, pool), std::runtime_error);
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/TopoSort.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/ExactAssigner.h"
+#include "planner/LongestPathDag.h"
+#include "plan_test_helpers.h"
+#include <algorithm>
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static PlanResult greedyPlan(const CourseGraph &g, const std::vector<int> &credits, const PlanConstraints &pc)
+{
+    TopoResult topo;
+    EarliestTerms et = topoAndEarliestTerms(g, topo);
+    return assignTermsGreedy(g, topo, et.termByIdx, credits, pc);
+}
+
+TEST(ExactAssignerTest, BeatsGreedyOnCriticalChain)
+{
+    // FIFO topo đưa N1, N2 vào kỳ 1 trước, đẩy chuỗi C1 -> C2 -> C3 ra 4 kỳ
+    Course n1{"N1", "N1", 3, {}, {}};
+    Course n2{"N2", "N2", 3, {}, {}};
+    Course c1{"C1", "C1", 3, {}, {}};
+    Course c2{"C2", "C2", 3, {"C1"}, {}};
+    Course c3{"C3", "C3", 3, {"C2"}, {}};
+    Curriculum curr = makeCurriculum({n1, n2, c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult greedy = greedyPlan(g, credits, makeConstraints(8, 6));
+    ASSERT_TRUE(greedy.ok);
+    EXPECT_EQ(*std::max_element(greedy.termOfIdx.begin(), greedy.termOfIdx.end()), 4);
+
+    ExactPlan r = assignTermsExact(g, credits, makeConstraints(8, 6));
+    ASSERT_TRUE(r.plan.ok);
+    EXPECT_TRUE(r.optimal);
+    EXPECT_EQ(r.termsUsed, 3);
+    EXPECT_DOUBLE_EQ(r.gap, 0.0);
+    expectValid(g, credits, r.plan, makeConstraints(8, 6));
+
+    // Greedy báo vô nghiệm với 3 kỳ, exact vẫn xếp được
+    EXPECT_FALSE(greedyPlan(g, credits, makeConstraints(3, 6)).ok);
+    ExactPlan tight = assignTermsExact(g, credits, makeConstraints(3, 6));
+    EXPECT_TRUE(tight.plan.ok);
+    EXPECT_EQ(tight.termsUsed, 3);
+}
+
+TEST(ExactAssignerTest, BalancesLoadAfterMinimisingTerms)
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {}, {}};
+    Course c{"C", "C", 3, {}, {}};
+    Course d{"D", "D", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, c, d});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    ExactPlan r = assignTermsExact(g, credits, makeConstraints(4, 9));
+    ASSERT_TRUE(r.plan.ok);
+    EXPECT_TRUE(r.optimal);
+    EXPECT_EQ(r.termsUsed, 2);
+    EXPECT_EQ(r.loadSquares, 6 * 6 + 6 * 6); // 6 / 6 thay vì 9 / 3
+    EXPECT_EQ(r.loadSquaresLowerBound, r.loadSquares);
+}
+
+TEST(ExactAssignerTest, RespectsOfferedTermsAndProvesInfeasible)
+{
+    Course a{"A", "A", 3, {}, {}};
+    a.offered_terms = {2};
+    Course b{"B", "B", 3, {"A"}, {}};
+    b.offered_terms = {3, 5};
+    Course c{"C", "C", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, c});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    ExactPlan r = assignTermsExact(g, credits, makeConstraints(6, 6));
+    ASSERT_TRUE(r.plan.ok);
+    EXPECT_TRUE(r.optimal);
+    EXPECT_EQ(r.termsUsed, 3);
+    expectValid(g, credits, r.plan, makeConstraints(6, 6));
+
+    ExactPlan none = assignTermsExact(g, credits, makeConstraints(2, 6));
+    EXPECT_FALSE(none.plan.ok);
+    EXPECT_TRUE(none.optimal);
+    EXPECT_FALSE(none.plan.notes.empty());
+}
+
+TEST(ExactAssignerTest, TimeBudgetReturnsBestWithGap)
+{
+    std::mt19937 rng(5);
+    std::vector<Course> courses;
+    for (int i = 0; i < 60; i++)
+    {
+        Course c;
+        c.id = "R" + std::to_string(i);
+        c.name = c.id;
+        c.credits = 2 + rng() % 3;
+        for (int k = 0; k < 2 && i > 0; k++)
+            if (rng() % 2)
+                c.prerequisite.push_back("R" + std::to_string(rng() % i));
+        courses.push_back(c);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    ExactOptions opt;
+    opt.timeBudgetMs = 5;
+    ExactPlan r = assignTermsExact(g, credits, makeConstraints(20, 12), opt);
+    ASSERT_TRUE(r.plan.ok);
+    expectValid(g, credits, r.plan, makeConstraints(20, 12));
+    EXPECT_GE(r.gap, 0.0);
+    EXPECT_LE(r.termsLowerBound, r.termsUsed);
+    EXPECT_LE(r.loadSquaresLowerBound, r.loadSquares);
+    if (!r.optimal)
+    {
+        EXPECT_FALSE(r.plan.notes.empty());
+    }
+}
+
+static CourseGraph maskedGraph(int V, const std::vector<int> &from, const std::vector<int> &to,
+                               const std::vector<uint64_t> &masks)
+{
+    std::vector<std::string> ids;
+    for (int i = 0; i < V; i++)
+        ids.push_back("u" + std::to_string(i));
+    CourseGraph g;
+    g.buildFromEdges(ids, from, to);
+    g.offeredMask = masks;
+    return g;
+}
+
+TEST(ExactAssignerTest, WaitsThroughClosedTermWithoutLosingPlans)
+{
+    // Kỳ 4 không mở môn nào: nhánh chờ đi qua (tập đã xếp, kỳ 5) và không được
+    // bị coi là trội bởi chính trạng thái (tập đó, kỳ 4).
+    CourseGraph g = maskedGraph(7, {1, 3, 4, 0, 4}, {4, 5, 5, 6, 6},
+                                {0, 0, 0, 0x5a, 0, 0x65, 0x35});
+    std::vector<int> credits = {3, 3, 3, 4, 3, 4, 4};
+
+    for (int numTerms : {5, 6})
+    {
+        ExactPlan r = assignTermsExact(g, credits, makeConstraints(numTerms, 7));
+        ASSERT_TRUE(r.plan.ok) << numTerms;
+        EXPECT_TRUE(r.optimal);
+        EXPECT_EQ(r.termsUsed, 5);
+        expectValid(g, credits, r.plan, makeConstraints(numTerms, 7));
+    }
+}
+
+// Duyệt mọi cách gán kỳ: {số kỳ ít nhất, tổng bình phương nhỏ nhất ở số kỳ đó}
+static std::pair<int, long long> bruteForce(const CourseGraph &g, const std::vector<int> &credits,
+                                            int numTerms, int maxCredits)
+{
+    std::pair<int, long long> best{0, 0};
+    std::vector<int> term(g.V, 1);
+    while (true)
+    {
+        std::vector<long long> load(numTerms + 1, 0);
+        bool ok = true;
+        for (int u = 0; u < g.V && ok; u++)
+        {
+            load[term[u]] += credits[u];
+            ok = nextOfferedTerm(g.offered(u), term[u]) == term[u];
+            for (int p : g.radj[u])
+                ok = ok && term[p] < term[u];
+        }
+        int used = 0;
+        long long sq = 0;
+        for (int t = 1; t <= numTerms && ok; t++)
+        {
+            ok = load[t] <= maxCredits;
+            if (load[t] > 0)
+                used = t;
+            sq += load[t] * load[t];
+        }
+        if (ok && (best.first == 0 || used < best.first || (used == best.first && sq < best.second)))
+            best = {used, sq};
+        int i = 0;
+        while (i < g.V && term[i] == numTerms)
+            term[i++] = 1;
+        if (i == g.V)
+            break;
+        term[i]++;
+    }
+    return best;
+}
+
+TEST(ExactAssignerTest, MatchesBruteForceOnSmallMaskedInstances)
+{
+    std::mt19937 rng(11);
+    for (int iter = 0; iter < 200; iter++)
+    {
+        const int V = 2 + rng() % 5;
+        const int numTerms = 2 + rng() % 4;
+        const int maxCredits = 4 + rng() % 5;
+        std::vector<int> from, to, credits(V);
+        std::vector<uint64_t> masks(V, 0);
+        for (int u = 0; u < V; u++)
+        {
+            credits[u] = 1 + rng() % 4;
+            for (int p = 0; p < u; p++)
+                if (rng() % 3 == 0)
+                {
+                    from.push_back(p);
+                    to.push_back(u);
+                }
+            if (rng() % 2)
+                masks[u] = rng() % ((uint64_t(1) << numTerms) - 1) + 1;
+        }
+        CourseGraph g = maskedGraph(V, from, to, masks);
+
+        auto expected = bruteForce(g, credits, numTerms, maxCredits);
+        ExactPlan r = assignTermsExact(g, credits, makeConstraints(numTerms, maxCredits));
+        ASSERT_TRUE(r.optimal) << "iter " << iter;
+        ASSERT_EQ(r.plan.ok, expected.first > 0) << "iter " << iter;
+        if (!r.plan.ok)
+            continue;
+        EXPECT_EQ(r.termsUsed, expected.first) << "iter " << iter;
+        EXPECT_EQ(r.loadSquares, expected.second) << "iter " << iter;
+        expectValid(g, credits, r.plan, makeConstraints(numTerms, maxCredits));
+    }
+}
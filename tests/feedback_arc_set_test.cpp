@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/FeedbackArcSet.h"
+#include "graph/TopoSort.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/ProvisionalPlan.h"
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+TEST(FeedbackArcSetTest, DagHasNoArcs)
+{
+    Course c1{"A", "A", 3, {}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2});
+    CourseGraph g;
+    g.build(curr);
+    EXPECT_TRUE(findFeedbackArcSet(g).empty());
+}
+
+TEST(FeedbackArcSetTest, BreaksSharedEdgeOnce)
+{
+    // Hai chu trình A->B->C->A và A->B->D->A chung cạnh A->B: bỏ một cạnh là đủ
+    Course a{"A", "A", 3, {"C", "D"}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {"B"}, {}};
+    Course d{"D", "D", 3, {"B"}, {}};
+    Course s{"S", "S", 3, {"S"}, {}}; // self-loop luôn phải bỏ
+    Curriculum curr = makeCurriculum({a, b, c, d, s});
+    CourseGraph g;
+    g.build(curr);
+    std::vector<FeedbackArc> arcs = findFeedbackArcSet(g);
+    ASSERT_EQ(arcs.size(), 2u);
+    bool selfLoop = false;
+    for (const auto &e : arcs)
+        selfLoop |= e.prereq == e.course;
+    EXPECT_TRUE(selfLoop);
+    removeArcs(g, arcs);
+    EXPECT_EQ(g.E, 4);
+    EXPECT_TRUE(topoSort(g).success);
+}
+
+TEST(FeedbackArcSetTest, RandomGraphsBecomeAcyclicAndMinimal)
+{
+    std::mt19937 rng(9);
+    for (int round = 0; round < 20; round++)
+    {
+        const int n = 60;
+        std::vector<Course> courses;
+        for (int i = 0; i < n; i++)
+        {
+            Course x;
+            x.id = "N" + std::to_string(i);
+            x.name = x.id;
+            x.credits = 3;
+            for (int k = 0; k < 2; k++)
+                x.prerequisite.push_back("N" + std::to_string(rng() % n));
+            courses.push_back(x);
+        }
+        Curriculum curr = makeCurriculum(courses);
+        CourseGraph g;
+        g.build(curr);
+        std::vector<FeedbackArc> arcs = findFeedbackArcSet(g);
+        ASSERT_FALSE(arcs.empty());
+
+        // mỗi cạnh trong tập đều cần thiết: bỏ tất cả trừ nó thì vẫn còn chu trình
+        for (size_t skip = 0; skip < arcs.size(); skip++)
+        {
+            std::vector<FeedbackArc> others;
+            for (size_t i = 0; i < arcs.size(); i++)
+                if (i != skip)
+                    others.push_back(arcs[i]);
+            CourseGraph h = g;
+            removeArcs(h, others);
+            EXPECT_FALSE(topoSort(h).success);
+        }
+        removeArcs(g, arcs);
+        EXPECT_TRUE(topoSort(g).success);
+    }
+}
+
+TEST(FeedbackArcSetTest, ProvisionalPlanStillPlans)
+{
+    Course a{"A", "A", 3, {"B"}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {"B"}, {}};
+    Curriculum curr = makeCurriculum({a, b, c});
+    CourseGraph g;
+    g.build(curr);
+    PlanConstraints pc{};
+    pc.numTerms = 4;
+    pc.maxCreditsPerTerm = 6;
+    pc.minCreditsPerTerm = 1;
+    ProvisionalPlan p = assignTermsDroppingCycles(g, std::vector<int>(g.V, 3), pc);
+    EXPECT_TRUE(p.plan.ok);
+    ASSERT_EQ(p.dropped.size(), 1u);
+    EXPECT_EQ(p.plan.notes.size(), 1u);
+    EXPECT_NE(p.plan.notes[0].find("Provisionally dropped"), std::string::npos);
+    for (int u = 0; u < g.V; u++)
+        EXPECT_GT(p.plan.termOfIdx[u], 0);
+    EXPECT_EQ(g.E, 3); // g gốc không bị sửa
+}
@@ -4,8 +4,10 @@
 #include "graph/CycleDiagnosis.h"
 #include "model/Course.h"
 #include "model/Curriculum.h"
+#include "util/ThreadPool.h"
 #include <unordered_set>
 #include <algorithm>
+#include <queue>
 
 static Curriculum makeCurriculum(const std::vector<Course> &courses)
 {
@@ -246,3 +248,334 @@ TEST(GraphTopoTest, MultiplePrerequisites)
     ASSERT_EQ(res.order.size(), 4);
     EXPECT_EQ(res.order[3], idxc4);
 }
+TEST(GraphTopoTest, ReverseAdjacencyMatchesForward)
+{
+    Course c1{"IP101", "Intro to Program", 3, {}, {}};
+    Course c2{"DS102", "Data Structures", 3, {"IP101"}, {}};
+    Course c3{"MA101", "Calculus I", 3, {}, {}};
+    Course c4{"AL201", "Algorithms", 3, {"DS102", "MA101"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    EXPECT_EQ(g.E, 3);
+    ASSERT_EQ(g.radj.size(), 4u);
+    int idxAL = g.idToIdx.at("AL201");
+    EXPECT_EQ(g.radj.degree(idxAL), g.indeg[idxAL]);
+    std::unordered_set<int> pre(g.radj[idxAL].begin(), g.radj[idxAL].end());
+    EXPECT_TRUE(pre.count(g.idToIdx.at("DS102")));
+    EXPECT_TRUE(pre.count(g.idToIdx.at("MA101")));
+    for (int u = 0; u < g.V; u++)
+    {
+        for (int v : g.adj[u])
+        {
+            bool found = std::find(g.radj[v].begin(), g.radj[v].end(), u) != g.radj[v].end();
+            EXPECT_TRUE(found) << g.idxToId[u] << " -> " << g.idxToId[v];
+        }
+    }
+}
+TEST(GraphTopoTest, ParallelLevelsDiamond)
+{
+    Course c1{"IP101", "Intro to Program", 3, {}, {}};
+    Course c2{"DS102", "Data Structures", 3, {"IP101"}, {}};
+    Course c3{"MA101", "Calculus I", 3, {}, {}};
+    Course c4{"AL201", "Algorithms", 3, {"DS102", "MA101"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    TopoResult res = topoSortParallel(g, 4);
+    EXPECT_TRUE(res.success);
+    ASSERT_EQ(res.order.size(), 4);
+    ASSERT_EQ(res.levelStart.size(), 4);
+    EXPECT_EQ(res.levelStart[0], 0);
+    EXPECT_EQ(res.levelStart[1], 2);
+    EXPECT_EQ(res.levelStart[2], 3);
+    EXPECT_EQ(res.levelStart[3], 4);
+    EXPECT_EQ(res.order[2], g.idToIdx.at("DS102"));
+    EXPECT_EQ(res.order[3], g.idToIdx.at("AL201"));
+}
+TEST(GraphTopoTest, ParallelMatchesAcrossThreadCounts)
+{
+    int n = 5000;
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "A" + std::to_string(i);
+        a.name = "Course " + std::to_string(i);
+        a.credits = 3;
+        if (i >= 7)
+            a.prerequisite.push_back("A" + std::to_string(i / 7));
+        if (i >= 3)
+            a.prerequisite.push_back("A" + std::to_string(i - 3));
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    TopoResult one = topoSortParallel(g, 1);
+    TopoResult many = topoSortParallel(g, 4);
+    EXPECT_TRUE(one.success);
+    EXPECT_EQ(one.order, many.order);
+    EXPECT_EQ(one.levelStart, many.levelStart);
+    std::vector<int> pos(g.V);
+    for (int i = 0; i < g.V; i++)
+        pos[one.order[i]] = i;
+    for (int u = 0; u < g.V; u++)
+        for (int v : g.adj[u])
+            EXPECT_LT(pos[u], pos[v]);
+}
+TEST(GraphTopoTest, ParallelDetectsCycle)
+{
+    Course c1{"IP101", "Intro to Program", 3, {"AL201"}, {}};
+    Course c2{"AL201", "Algorithms", 3, {"IP101"}, {}};
+    Course c3{"MA101", "Calculus I", 3, {}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    TopoResult res = topoSortParallel(g, 2);
+    EXPECT_FALSE(res.success);
+    EXPECT_EQ(res.order.size(), 1);
+}
+TEST(GraphTopoTest, SccReportsEveryCycle)
+{
+    Course c1{"A", "A", 3, {"B"}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Course c3{"C", "C", 3, {"E"}, {}};
+    Course c4{"D", "D", 3, {"C"}, {}};
+    Course c5{"E", "E", 3, {"D", "C"}, {}};
+    Course c6{"F", "F", 3, {"F"}, {}};
+    Course c7{"G", "G", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4, c5, c6, c7});
+    CourseGraph g;
+    g.build(curr);
+    SccDecomposition scc = findSccs(g);
+    EXPECT_EQ(scc.count, 4);
+    ASSERT_EQ(scc.cyclic.size(), 3);
+    std::vector<size_t> sizes;
+    for (const auto &comp : scc.cyclic)
+        sizes.push_back(comp.size());
+    std::sort(sizes.begin(), sizes.end());
+    EXPECT_EQ(sizes, (std::vector<size_t>{1, 2, 3}));
+    EXPECT_EQ(scc.compOf[g.idToIdx.at("A")], scc.compOf[g.idToIdx.at("B")]);
+    EXPECT_NE(scc.compOf[g.idToIdx.at("A")], scc.compOf[g.idToIdx.at("G")]);
+
+    // C -> E -> C, C -> D -> E -> C, A -> B -> A, F -> F
+    std::vector<std::vector<int>> cycles = enumerateCycles(g, scc, 10);
+    EXPECT_EQ(cycles.size(), 4);
+    for (const auto &cycle : cycles)
+    {
+        for (size_t i = 0; i < cycle.size(); i++)
+        {
+            int u = cycle[i];
+            int v = cycle[(i + 1) % cycle.size()];
+            bool found = std::find(g.adj[u].begin(), g.adj[u].end(), v) != g.adj[u].end();
+            EXPECT_TRUE(found) << g.idxToId[u] << " -> " << g.idxToId[v];
+        }
+    }
+    EXPECT_EQ(enumerateCycles(g, scc, 1).size(), 3);
+}
+TEST(GraphTopoTest, LongChainCycleNoRecursion)
+{
+    int n = 200000;
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "A" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 3;
+        a.prerequisite.push_back("A" + std::to_string((i + n - 1) % n));
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    EXPECT_EQ(findOneCycle(g).size(), n);
+    SccDecomposition scc = findSccs(g);
+    EXPECT_EQ(scc.count, 1);
+    ASSERT_EQ(scc.cyclic.size(), 1);
+    EXPECT_EQ(scc.cyclic[0].size(), n);
+    std::vector<std::vector<int>> cycles = enumerateCycles(g, scc, 5);
+    ASSERT_EQ(cycles.size(), 1);
+    EXPECT_EQ(cycles[0].size(), n);
+}
+TEST(GraphTopoTest, KeyedKahnLexicographic)
+{
+    // nạp theo thứ tự lộn xộn, kết quả vẫn theo id
+    Course c1{"MATH2", "M2", 3, {"MATH1"}, {}};
+    Course c2{"CS1", "CS1", 3, {}, {}};
+    Course c3{"MATH1", "M1", 3, {}, {}};
+    Course c4{"ART", "Art", 3, {}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    TopoResult r = topoSortByKey(g, topoKeyLexicographic(g));
+    ASSERT_TRUE(r.success);
+    std::vector<std::string> ids;
+    for (int u : r.order)
+        ids.push_back(g.idxToId[u]);
+    EXPECT_EQ(ids, (std::vector<std::string>{"ART", "CS1", "MATH1", "MATH2"}));
+}
+TEST(GraphTopoTest, KeyedKahnCriticalPathAndCredits)
+{
+    Course c1{"A", "A", 4, {}, {}};
+    Course c2{"B", "B", 2, {}, {}};
+    Course c3{"C", "C", 3, {"B"}, {}};
+    Course c4{"D", "D", 3, {"C"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    int a = g.idToIdx.at("A"), b = g.idToIdx.at("B");
+
+    TopoResult byPath = topoSortByKey(g, topoKeyCriticalPath(g));
+    ASSERT_TRUE(byPath.success);
+    EXPECT_EQ(byPath.order[0], b); // B mở chuỗi dài nhất
+
+    TopoResult byCredits = topoSortByKey(g, topoKeyCredits(g, curr));
+    ASSERT_TRUE(byCredits.success);
+    EXPECT_EQ(byCredits.order[0], b);
+    EXPECT_EQ(byCredits.order.back(), a); // C, D (3 tín chỉ) mở ra trước A (4 tín chỉ)
+
+    EXPECT_THROW(topoSortByKey(g, {1, 2}), std::runtime_error);
+}
+TEST(GraphTopoTest, KeyedKahnLargeValidAndCycle)
+{
+    int n = 5000;
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "X" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 3;
+        if (i > 0)
+            a.prerequisite.push_back("X" + std::to_string((i * 7919) % i));
+        if (i > 1)
+            a.prerequisite.push_back("X" + std::to_string(i / 2));
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    std::vector<std::int64_t> key(n);
+    for (int u = 0; u < n; u++)
+        key[u] = (u * 31) % 97;
+    TopoResult r = topoSortByKey(g, key);
+    ASSERT_TRUE(r.success);
+    ASSERT_EQ((int)r.order.size(), n);
+    std::vector<int> pos(n);
+    for (int i = 0; i < n; i++)
+        pos[r.order[i]] = i;
+    for (int u = 0; u < n; u++)
+        for (int v : g.adj[u])
+            EXPECT_LT(pos[u], pos[v]);
+
+    Course x{"P", "P", 3, {"Q"}, {}};
+    Course y{"Q", "Q", 3, {"P"}, {}};
+    Curriculum cyc = makeCurriculum({x, y});
+    CourseGraph gc;
+    gc.build(cyc);
+    EXPECT_FALSE(topoSortByKey(gc, topoKeyLexicographic(gc)).success);
+}
+TEST(GraphTopoTest, BuildFromEdgesMatchesBuild)
+{
+    Course c1{"CALC1", "Calculus I", 3, {}, {}};
+    Course c2{"CALC2", "Calculus II", 3, {"CALC1"}, {}};
+    Course c3{"PHYS", "Physics", 3, {"CALC1", "CALC2"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph a;
+    a.build(curr);
+
+    CourseGraph b;
+    b.buildFromEdges({"CALC1", "CALC2", "PHYS"}, {0, 0, 1}, {1, 2, 2});
+    EXPECT_EQ(b.V, a.V);
+    EXPECT_EQ(b.E, a.E);
+    EXPECT_EQ(b.adj.offset, a.adj.offset);
+    EXPECT_EQ(b.adj.target, a.adj.target);
+    EXPECT_EQ(b.radj.target, a.radj.target);
+    EXPECT_EQ(b.indeg, a.indeg);
+    EXPECT_EQ(b.idToIdx.at("PHYS"), 2);
+
+    CourseGraph bad;
+    EXPECT_THROW(bad.buildFromEdges({"A", "B"}, {0}, {2}), std::runtime_error);
+    EXPECT_THROW(bad.buildFromEdges({"A", "A"}, {}, {}), std::runtime_error);
+    EXPECT_THROW(bad.buildFromEdges({"A", "B"}, {0, 1}, {1}), std::runtime_error);
+}
+TEST(GraphTopoTest, BuildFromEdgesParallelMatchesSerial)
+{
+    const int V = 50000, E = 300000;
+    std::vector<std::string> ids;
+    for (int i = 0; i < V; i++)
+        ids.push_back("E" + std::to_string(i));
+    std::vector<int> from(E), to(E);
+    unsigned x = 12345;
+    for (int e = 0; e < E; e++)
+    {
+        x = x * 1103515245u + 12345u;
+        to[e] = 1 + (x >> 8) % (V - 1);
+        x = x * 1103515245u + 12345u;
+        from[e] = (x >> 8) % to[e];
+    }
+    CourseGraph serial, parallel;
+    serial.buildFromEdges(ids, from, to);
+    ThreadPool pool(4);
+    parallel.buildFromEdges(ids, from, to, &pool);
+    EXPECT_EQ(parallel.adj.offset, serial.adj.offset);
+    EXPECT_EQ(parallel.adj.target, serial.adj.target);
+    EXPECT_EQ(parallel.radj.offset, serial.radj.offset);
+    EXPECT_EQ(parallel.radj.target, serial.radj.target);
+    EXPECT_TRUE(topoSort(parallel).success);
+}
+TEST(GraphTopoTest, IndegreeKernelMatchesScalarQueue)
+{
+    // Đồ thị dày, có cạnh lặp (prereq khai báo trùng)
+    const int V = 600;
+    std::vector<std::string> ids;
+    for (int i = 0; i < V; i++)
+        ids.push_back("K" + std::to_string(i));
+    std::vector<int> from, to;
+    unsigned x = 777;
+    for (int v = 1; v < V; v++)
+    {
+        for (int k = 0; k < 1 + v % 23; k++)
+        {
+            x = x * 1103515245u + 12345u;
+            from.push_back((x >> 8) % v);
+            to.push_back(v);
+            if (k % 5 == 0)
+            {
+                from.push_back(from.back());
+                to.push_back(v);
+            }
+        }
+    }
+    CourseGraph g;
+    g.buildFromEdges(ids, from, to);
+
+    std::vector<int> indeg = g.indeg, expected;
+    std::queue<int> q;
+    for (int u = 0; u < V; u++)
+        if (indeg[u] == 0)
+            q.push(u);
+    while (!q.empty())
+    {
+        int u = q.front();
+        q.pop();
+        expected.push_back(u);
+        for (int v : g.adj[u])
+            if (--indeg[v] == 0)
+                q.push(v);
+    }
+    ASSERT_EQ((int)expected.size(), V);
+
+    TopoResult r = topoSort(g);
+    EXPECT_TRUE(r.success);
+    EXPECT_EQ(r.order, expected);
+
+    // Thêm cạnh ngược tạo chu trình: báo thất bại
+    from.push_back(V - 1);
+    to.push_back(0);
+    CourseGraph cyc;
+    cyc.buildFromEdges(ids, from, to);
+    EXPECT_FALSE(topoSort(cyc).success);
+}
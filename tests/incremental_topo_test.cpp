@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/IncrementalTopo.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "graph/TopoSort.h"
+#include "planner/LongestPathDag.h"
+#include <algorithm>
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+// Kiểm tra thứ tự hợp lệ và term khớp với tính lại từ đầu (kể cả kỳ mở)
+static void expectConsistent(const IncrementalTopo &inc)
+{
+    std::vector<int> order = inc.order();
+    std::vector<int> pos(inc.capacity(), -1);
+    for (int i = 0; i < (int)order.size(); i++)
+        pos[order[i]] = i;
+    std::vector<int> term(inc.capacity(), 0);
+    for (int u : order)
+    {
+        term[u] = 1;
+        for (int p : inc.predecessors(u))
+        {
+            EXPECT_LT(pos[p], pos[u]) << inc.idOf(p) << " -> " << inc.idOf(u);
+            term[u] = std::max(term[u], term[p] + 1);
+        }
+        if (int t = nextOfferedTerm(inc.offered(u), term[u]))
+            term[u] = t;
+    }
+    EXPECT_EQ(term, inc.termByIdx());
+}
+
+TEST(IncrementalTopoTest, AddEdgeReordersAffectedRegion)
+{
+    Course c1{"IP101", "Intro to Program", 3, {}, {}};
+    Course c2{"DS102", "Data Structures", 3, {"IP101"}, {}};
+    Course c3{"MA101", "Calculus I", 3, {}, {}};
+    Course c4{"MA102", "Calculus II", 3, {"MA101"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    IncrementalTopo inc(g);
+
+    int ds = inc.indexOf("DS102"), ma1 = inc.indexOf("MA101"), ma2 = inc.indexOf("MA102");
+    EXPECT_TRUE(inc.addEdge(ds, ma1));
+    EXPECT_LT(inc.position(ds), inc.position(ma1));
+    EXPECT_EQ(inc.termByIdx()[ma1], 3);
+    EXPECT_EQ(inc.termByIdx()[ma2], 4);
+    expectConsistent(inc);
+
+    EXPECT_TRUE(inc.removeEdge(ds, ma1));
+    EXPECT_EQ(inc.termByIdx()[ma2], 2);
+    expectConsistent(inc);
+}
+
+TEST(IncrementalTopoTest, RejectsCycle)
+{
+    Course c1{"IP101", "Intro to Program", 3, {}, {}};
+    Course c2{"DS102", "Data Structures", 3, {"IP101"}, {}};
+    Course c3{"AL201", "Algorithms", 3, {"DS102"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    IncrementalTopo inc(g);
+
+    std::vector<int> before = inc.order();
+    EXPECT_FALSE(inc.addEdge(inc.indexOf("AL201"), inc.indexOf("IP101")));
+    EXPECT_FALSE(inc.addEdge(inc.indexOf("DS102"), inc.indexOf("DS102")));
+    EXPECT_EQ(before, inc.order());
+    expectConsistent(inc);
+}
+
+TEST(IncrementalTopoTest, AddAndRemoveCourse)
+{
+    Course c1{"IP101", "Intro to Program", 3, {}, {}};
+    Course c2{"DS102", "Data Structures", 3, {"IP101"}, {}};
+    Course c3{"AL201", "Algorithms", 3, {"DS102"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    IncrementalTopo inc(g);
+
+    int cap = inc.addCourse("CAP499");
+    EXPECT_THROW(inc.addCourse("CAP499"), std::runtime_error);
+    EXPECT_TRUE(inc.addEdge(inc.indexOf("AL201"), cap));
+    EXPECT_EQ(inc.termByIdx()[cap], 4);
+
+    inc.removeCourse(inc.indexOf("DS102"));
+    EXPECT_EQ(inc.indexOf("DS102"), -1);
+    EXPECT_EQ(inc.order().size(), 3);
+    EXPECT_EQ(inc.termByIdx()[cap], 2);
+    EXPECT_THROW(inc.addEdge(cap, 1000), std::runtime_error);
+    expectConsistent(inc);
+}
+
+TEST(IncrementalTopoTest, RandomEditsMatchRecompute)
+{
+    const int n = 60;
+    // lần 2: mỗi môn mở ở 1-3 kỳ ngẫu nhiên trong 1..12
+    for (bool masked : {false, true})
+    {
+        std::mt19937 rng(7);
+        std::vector<Course> courses;
+        for (int i = 0; i < n; i++)
+        {
+            Course a;
+            a.id = "C" + std::to_string(i);
+            a.name = a.id;
+            a.credits = 3;
+            for (int k = masked ? 1 + rng() % 3 : 0; k > 0; k--)
+                a.offered_terms.insert((unsigned short)(1 + rng() % 12));
+            courses.push_back(a);
+        }
+        Curriculum curr = makeCurriculum(courses);
+        CourseGraph g;
+        g.build(curr);
+        IncrementalTopo inc(g);
+        expectConsistent(inc);
+
+        int accepted = 0, rejected = 0;
+        for (int step = 0; step < 600; step++)
+        {
+            int a = rng() % n, b = rng() % n;
+            if (rng() % 4 == 0)
+                inc.removeEdge(a, b);
+            else if (inc.addEdge(a, b))
+                accepted++;
+            else
+                rejected++;
+            expectConsistent(inc);
+        }
+        EXPECT_GT(accepted, 0);
+        EXPECT_GT(rejected, 0);
+
+        // dựng lại đồ thị từ đầu: computeEarliestTerms phải cho đúng termByIdx
+        std::vector<int> from, to;
+        for (int u = 0; u < n; u++)
+            for (int v : inc.successors(u))
+            {
+                from.push_back(u);
+                to.push_back(v);
+            }
+        CourseGraph fresh;
+        fresh.buildFromEdges(g.idxToId, from, to);
+        fresh.offeredMask = g.offeredMask;
+        EXPECT_EQ(computeEarliestTerms(fresh, topoSort(fresh)).termByIdx, inc.termByIdx()) << "masked=" << masked;
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/TermAssigner.h"
+#include "plan_test_helpers.h"
+#include <algorithm>
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+TEST(ListSchedulerTest, CriticalChainGoesFirst)
+{
+    // Kahn FIFO + greedy cần 4 kỳ; ưu tiên chuỗi C1 -> C2 -> C3 chỉ cần 3
+    Course n1{"N1", "N1", 3, {}, {}};
+    Course n2{"N2", "N2", 3, {}, {}};
+    Course c1{"C1", "C1", 3, {}, {}};
+    Course c2{"C2", "C2", 3, {"C1"}, {}};
+    Course c3{"C3", "C3", 3, {"C2"}, {}};
+    Curriculum curr = makeCurriculum({n1, n2, c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult r = assignTermsListScheduling(g, credits, makeConstraints(3, 6));
+    ASSERT_TRUE(r.ok);
+    expectValid(g, credits, r, makeConstraints(3, 6));
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("C1")], 1);
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("C3")], 3);
+    EXPECT_EQ(*std::max_element(r.termOfIdx.begin(), r.termOfIdx.end()), 3);
+}
+
+TEST(ListSchedulerTest, HonoursOfferedTermsAndReportsInfeasible)
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    b.offered_terms = {4};
+    Course c{"C", "C", 3, {"B"}, {}};
+    Curriculum curr = makeCurriculum({a, b, c});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult r = assignTermsListScheduling(g, credits, makeConstraints(6, 6));
+    ASSERT_TRUE(r.ok);
+    expectValid(g, credits, r, makeConstraints(6, 6));
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("B")], 4);
+    EXPECT_EQ(r.termOfIdx[g.idToIdx.at("C")], 5);
+
+    PlanResult none = assignTermsListScheduling(g, credits, makeConstraints(4, 6));
+    EXPECT_FALSE(none.ok);
+    EXPECT_FALSE(none.notes.empty());
+    EXPECT_EQ(none.termOfIdx[g.idToIdx.at("C")], 0);
+}
+
+TEST(ListSchedulerTest, RandomCurriculaStayValid)
+{
+    for (unsigned seed = 1; seed <= 5; seed++)
+    {
+        std::mt19937 rng(seed);
+        std::vector<Course> courses;
+        for (int i = 0; i < 300; i++)
+        {
+            Course c;
+            c.id = "L" + std::to_string(i);
+            c.name = c.id;
+            c.credits = 1 + rng() % 4;
+            for (int k = 0; k < 3 && i > 0; k++)
+                if (rng() % 2)
+                    c.prerequisite.push_back("L" + std::to_string(rng() % i));
+            courses.push_back(c);
+        }
+        Curriculum curr = makeCurriculum(courses);
+        CourseGraph g;
+        g.build(curr);
+        auto credits = creditsOf(g, curr);
+
+        PlanResult r = assignTermsListScheduling(g, credits, makeConstraints(64, 18));
+        ASSERT_TRUE(r.ok) << "seed " << seed;
+        expectValid(g, credits, r, makeConstraints(64, 18));
+    }
+}
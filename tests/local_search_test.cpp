@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/LocalSearch.h"
+#include "planner/TermAssigner.h"
+#include "util/ThreadPool.h"
+#include "plan_test_helpers.h"
+#include <algorithm>
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static Curriculum fourIndependent()
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {}, {}};
+    Course c{"C", "C", 3, {}, {}};
+    Course d{"D", "D", 3, {}, {}};
+    return makeCurriculum({a, b, c, d});
+}
+
+TEST(LocalSearchTest, BalancesTermLoads)
+{
+    Curriculum curr = fourIndependent();
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult start;
+    start.termOfIdx = {1, 1, 1, 2}; // 9 / 3
+    ThreadPool pool(2);
+    LocalSearchResult r = improvePlanLocalSearch(g, credits, makeConstraints(4, 9), start, {}, pool);
+    EXPECT_EQ(r.termsUsed, 2);
+    EXPECT_EQ(r.loadSquares, 6 * 6 + 6 * 6);
+    EXPECT_GE(r.bestChain, 0);
+    expectValid(g, credits, r.plan, makeConstraints(4, 9));
+}
+
+TEST(LocalSearchTest, ShrinksTermsUsed)
+{
+    Curriculum curr = fourIndependent();
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult start;
+    start.termOfIdx = {1, 2, 3, 4};
+    LocalSearchResult r = improvePlanLocalSearch(g, credits, makeConstraints(4, 12), start, {}, 2);
+    EXPECT_EQ(r.termsUsed, 1);
+    expectValid(g, credits, r.plan, makeConstraints(4, 12));
+}
+
+TEST(LocalSearchTest, DeterministicForSeedAcrossThreadCounts)
+{
+    std::mt19937 rng(11);
+    std::vector<Course> courses;
+    for (int i = 0; i < 120; i++)
+    {
+        Course c;
+        c.id = "S" + std::to_string(i);
+        c.name = c.id;
+        c.credits = 1 + rng() % 4;
+        for (int k = 0; k < 2 && i > 0; k++)
+            if (rng() % 3 == 0)
+                c.prerequisite.push_back("S" + std::to_string(rng() % i));
+        courses.push_back(c);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+    PlanConstraints pc = makeConstraints(30, 15);
+
+    PlanResult start = assignTermsListScheduling(g, credits, pc);
+    ASSERT_TRUE(start.ok);
+    LocalSearchOptions opt;
+    opt.seed = 7;
+    opt.chains = 6;
+    opt.iterations = 5000;
+    LocalSearchResult one = improvePlanLocalSearch(g, credits, pc, start, opt, 1);
+    LocalSearchResult four = improvePlanLocalSearch(g, credits, pc, start, opt, 4);
+    EXPECT_EQ(one.plan.termOfIdx, four.plan.termOfIdx);
+    EXPECT_EQ(one.bestChain, four.bestChain);
+    expectValid(g, credits, one.plan, pc);
+
+    std::vector<long long> load(31, 0);
+    int used = 0;
+    for (int u = 0; u < g.V; u++)
+    {
+        load[start.termOfIdx[u]] += credits[u];
+        used = std::max(used, start.termOfIdx[u]);
+    }
+    long long sq = 0;
+    for (long long l : load)
+        sq += l * l;
+    EXPECT_LE(one.termsUsed, used);
+    if (one.termsUsed == used)
+    {
+        EXPECT_LE(one.loadSquares, sq);
+    }
+}
+
+TEST(LocalSearchTest, RejectsInvalidStart)
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({a, b});
+    CourseGraph g;
+    g.build(curr);
+    auto credits = creditsOf(g, curr);
+
+    PlanResult start;
+    start.termOfIdx = {2, 2};
+    EXPECT_THROW(improvePlanLocalSearch(g, credits, makeConstraints(4, 9), start), std::runtime_error);
+    start.termOfIdx = {1, 0};
+    EXPECT_THROW(improvePlanLocalSearch(g, credits, makeConstraints(4, 9), start), std::runtime_error);
+}
@@ -115,6 +115,68 @@ TEST_F(OfferedTermsTest, InfeasibleDueToOfferedTerms)
     }
 }
 
+TEST(OfferedMaskTest, NextAndPrevOfferedTerm)
+{
+    const std::uint64_t odd = 0b1010101; // kỳ 1, 3, 5, 7
+    EXPECT_EQ(nextOfferedTerm(odd, 1), 1);
+    EXPECT_EQ(nextOfferedTerm(odd, 2), 3);
+    EXPECT_EQ(nextOfferedTerm(odd, 7), 7);
+    EXPECT_EQ(nextOfferedTerm(odd, 8), 0);
+    EXPECT_EQ(nextOfferedTerm(0, 9), 9); // 0 = mở mọi kỳ
+    EXPECT_EQ(nextOfferedTerm(std::uint64_t(1) << 63, 2), 64);
+    EXPECT_EQ(nextOfferedTerm(std::uint64_t(1) << 63, 65), 0);
+
+    EXPECT_EQ(prevOfferedTerm(odd, 6), 5);
+    EXPECT_EQ(prevOfferedTerm(odd, 1), 1);
+    EXPECT_EQ(prevOfferedTerm(0b110, 1), 0);
+    EXPECT_EQ(prevOfferedTerm(odd, 100), 7);
+}
+
+TEST_F(OfferedTermsTest, EarliestTermJumpsToOfferedTerm)
+{
+    json j = {
+        {"constraints", {{"numTerms", 8}, {"maxCreditsPerTerm", 18}, {"minCreditsPerTerm", 3}, {"enforceCoreqTogether", true}}},
+        {"courses", {{{"id", "A"}, {"name", "A"}, {"credits", 3}, {"offered_terms", {2, 6}}}, {{"id", "B"}, {"name", "B"}, {"credits", 3}, {"prerequisite", {"A"}}, {"offered_terms", {3, 7}}}, {{"id", "C"}, {"name", "C"}, {"credits", 3}, {"prerequisite", {"B"}}, {"offered_terms", {1, 2}}}}}};
+
+    auto loadResult = loadFromJson(j);
+    CourseGraph graph;
+    graph.build(loadResult.curriculum);
+    EXPECT_EQ(graph.offeredMask[graph.idToIdx.at("A")], 0b100010u);
+
+    auto earliest = computeEarliestTerms(graph, topoSort(graph));
+    EXPECT_EQ(earliest.termByIdx[graph.idToIdx.at("A")], 2);
+    EXPECT_EQ(earliest.termByIdx[graph.idToIdx.at("B")], 3);
+    // C cần kỳ >= 4 nhưng chỉ mở kỳ 1, 2
+    EXPECT_FALSE(earliest.ok);
+
+    TopoResult topo;
+    EXPECT_EQ(topoAndEarliestTerms(graph, topo).termByIdx, earliest.termByIdx);
+}
+
+TEST_F(OfferedTermsTest, RealDatasetPlansOnOfferedTerms)
+{
+    auto loadResult = loadFromJsonFile("data/offered_terms_wintersummer.json");
+    CourseGraph graph;
+    graph.build(loadResult.curriculum);
+    auto topo = topoSort(graph);
+    auto earliest = computeEarliestTerms(graph, topo);
+    ASSERT_TRUE(earliest.ok);
+
+    std::vector<int> creditsByIdx(graph.V);
+    loadResult.curriculum.for_each([&](const Course &c)
+                                   { creditsByIdx[graph.idToIdx.at(c.id)] = c.credits; });
+    auto result = assignTermsGreedy(graph, topo, earliest.termByIdx, creditsByIdx, loadResult.constraints);
+    ASSERT_TRUE(result.ok);
+
+    loadResult.curriculum.for_each([&](const Course &c)
+                                   {
+        const int u = graph.idToIdx.at(c.id);
+        const int t = result.termOfIdx[u];
+        EXPECT_TRUE(c.offered_terms.count(t)) << c.id << " placed in term " << t;
+        for (const auto &pre : c.prerequisite)
+            EXPECT_LT(result.termOfIdx[graph.idToIdx.at(pre)], t) << pre << " -> " << c.id; });
+}
+
 class HintsTest : public ::testing::Test
 {
 protected:
@@ -0,0 +1,69 @@
+#pragma once
+// Fixture chung cho test đồ thị / planner xếp kỳ (PlanResult.termOfIdx)
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/CourseGraph.h"
+#include "model/Curriculum.h"
+#include "model/PlanConstraints.h"
+#include "planner/TermAssigner.h"
+
+// DAG ngẫu nhiên C0..C(n-1): prereq của Ci lấy trong C0..C(i-1), mỗi môn đúng
+// maxPrereqs prereq (có thể trùng), hoặc 0..maxPrereqs nếu randomCount
+inline Curriculum randomCurriculum(int n, int maxPrereqs, unsigned seed, bool randomCount = false)
+{
+    std::mt19937 rng(seed);
+    Curriculum curr;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "C" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 3;
+        int k = i == 0 ? 0 : maxPrereqs;
+        if (randomCount && i > 0)
+            k = (int)(rng() % (maxPrereqs + 1));
+        for (int j = 0; j < k; j++)
+            a.prerequisite.push_back("C" + std::to_string(rng() % i));
+        curr.add(a);
+    }
+    return curr;
+}
+
+inline PlanConstraints makeConstraints(int numTerms, int maxCredits, bool together = false)
+{
+    PlanConstraints pc{};
+    pc.numTerms = numTerms;
+    pc.maxCreditsPerTerm = maxCredits;
+    pc.minCreditsPerTerm = 0;
+    pc.enforceCoreqTogether = together;
+    return pc;
+}
+
+inline std::vector<int> creditsOf(const CourseGraph &g, const Curriculum &curr)
+{
+    std::vector<int> credits(g.V);
+    for (int u = 0; u < g.V; u++)
+        credits[u] = curr.get(g.idxToId[u]).credits;
+    return credits;
+}
+
+// Kỳ trong [1, numTerms], đúng kỳ mở, prereq học trước, tải mỗi kỳ <= maxCreditsPerTerm
+inline void expectValid(const CourseGraph &g, const std::vector<int> &credits, const PlanResult &r,
+                        const PlanConstraints &pc)
+{
+    ASSERT_EQ((int)r.termOfIdx.size(), g.V);
+    std::vector<int> load(pc.numTerms + 1, 0);
+    for (int u = 0; u < g.V; u++)
+    {
+        ASSERT_GT(r.termOfIdx[u], 0) << g.idxToId[u];
+        ASSERT_LE(r.termOfIdx[u], pc.numTerms) << g.idxToId[u];
+        load[r.termOfIdx[u]] += credits[u];
+        EXPECT_EQ(nextOfferedTerm(g.offered(u), r.termOfIdx[u]), r.termOfIdx[u]) << g.idxToId[u];
+        for (int p : g.radj[u])
+            EXPECT_LT(r.termOfIdx[p], r.termOfIdx[u]);
+    }
+    for (int t : load)
+        EXPECT_LE(t, pc.maxCreditsPerTerm);
+}
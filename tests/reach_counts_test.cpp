@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/ReachCounts.h"
+#include "graph/TopoSort.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "planner/Hints.h"
+#include "plan_test_helpers.h"
+#include <cmath>
+#include <random>
+#include <set>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static int dfsCount(const CsrAdjacency &dir, int s)
+{
+    std::set<int> seen;
+    std::vector<int> st{s};
+    while (!st.empty())
+    {
+        int u = st.back();
+        st.pop_back();
+        for (int v : dir[u])
+            if (seen.insert(v).second)
+                st.push_back(v);
+    }
+    return (int)seen.size();
+}
+
+TEST(ReachCountsTest, DiamondCountsOnce)
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {"A"}, {}};
+    Course d{"D", "D", 3, {"B", "C"}, {}};
+    Curriculum curr = makeCurriculum({a, b, c, d});
+    CourseGraph g;
+    g.build(curr);
+    ReachCounts rc = computeReachCounts(g);
+    ASSERT_TRUE(rc.success);
+    EXPECT_TRUE(rc.exact);
+    EXPECT_EQ(rc.descendants[g.idToIdx.at("A")], 3);
+    EXPECT_EQ(rc.ancestors[g.idToIdx.at("D")], 3);
+    EXPECT_EQ(rc.descendants[g.idToIdx.at("D")], 0);
+
+    TopoResult byImpact = topoSortByKey(g, topoKeyImpact(rc));
+    EXPECT_EQ(byImpact.order[0], g.idToIdx.at("A"));
+
+    std::vector<HintNote> hints = Hints::rankByImpact(g.idxToId, rc.descendants, 2);
+    ASSERT_EQ(hints.size(), 2u);
+    EXPECT_EQ(hints[0].actions.at("prioritize_course"), "A");
+    EXPECT_EQ(hints[1].actions.at("prioritize_course"), "B");
+}
+
+TEST(ReachCountsTest, ExactMatchesDfsAcrossBlocks)
+{
+    Curriculum curr = randomCurriculum(500, 3, 4);
+    CourseGraph g;
+    g.build(curr);
+    // bộ nhớ nhỏ để buộc nhiều khối cột
+    ReachCounts rc = computeReachCounts(g, 8 * 500);
+    ASSERT_TRUE(rc.success);
+    ASSERT_TRUE(rc.exact);
+    for (int u = 0; u < g.V; u++)
+    {
+        EXPECT_EQ(rc.descendants[u], dfsCount(g.adj, u));
+        EXPECT_EQ(rc.ancestors[u], dfsCount(g.radj, u));
+    }
+}
+
+TEST(ReachCountsTest, HyperLogLogFallbackIsClose)
+{
+    Curriculum curr = randomCurriculum(3000, 2, 8);
+    CourseGraph g;
+    g.build(curr);
+    ReachCounts rc = computeReachCounts(g, std::size_t(64) << 20, 1);
+    ASSERT_TRUE(rc.success);
+    EXPECT_FALSE(rc.exact);
+    ReachCounts exact = computeReachCounts(g);
+    double err = 0;
+    int n = 0;
+    for (int u = 0; u < g.V; u++)
+    {
+        if (exact.descendants[u] < 200)
+            continue;
+        err += std::fabs(rc.descendants[u] - exact.descendants[u]) / exact.descendants[u];
+        n++;
+    }
+    ASSERT_GT(n, 0);
+    EXPECT_LT(err / n, 0.15);
+
+    Course x{"X", "X", 3, {"Y"}, {}};
+    Course y{"Y", "Y", 3, {"X"}, {}};
+    Curriculum cyc = makeCurriculum({x, y});
+    CourseGraph gc;
+    gc.build(cyc);
+    EXPECT_FALSE(computeReachCounts(gc).success);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/ReachabilityIndex.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include <random>
+#include <set>
+#include <stdexcept>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static std::set<int> dfsFrom(const CourseGraph &g, int s)
+{
+    std::set<int> out;
+    std::vector<int> st{s};
+    while (!st.empty())
+    {
+        int u = st.back();
+        st.pop_back();
+        for (int v : g.adj[u])
+            if (out.insert(v).second)
+                st.push_back(v);
+    }
+    return out;
+}
+
+TEST(ReachabilityIndexTest, ChainAndBlockedCourses)
+{
+    Course c1{"CALC1", "Calculus I", 3, {}, {}};
+    Course c2{"CALC2", "Calculus II", 3, {"CALC1"}, {}};
+    Course c3{"CALC3", "Calculus III", 3, {"CALC2"}, {}};
+    Course c4{"PHYS", "Physics", 3, {}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    int a = g.idToIdx.at("CALC1"), b = g.idToIdx.at("CALC2"), c = g.idToIdx.at("CALC3"), p = g.idToIdx.at("PHYS");
+
+    for (auto kind : {ReachabilityIndex::Kind::Interval, ReachabilityIndex::Kind::Bitset})
+    {
+        ReachabilityIndex idx(g, kind);
+        EXPECT_EQ(idx.kind(), kind);
+        EXPECT_TRUE(idx.reaches(a, c));
+        EXPECT_FALSE(idx.reaches(c, a));
+        EXPECT_FALSE(idx.reaches(a, a));
+        EXPECT_FALSE(idx.reaches(p, c));
+        EXPECT_EQ(idx.descendants(a), (std::vector<int>{b, c}));
+        EXPECT_EQ(idx.countDescendants(a), 2);
+        EXPECT_TRUE(idx.descendants(p).empty());
+        EXPECT_GT(idx.memoryBytes(), 0u);
+    }
+}
+
+TEST(ReachabilityIndexTest, CycleThrows)
+{
+    Course c1{"A", "A", 3, {"B"}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2});
+    CourseGraph g;
+    g.build(curr);
+    EXPECT_THROW(ReachabilityIndex idx(g), std::runtime_error);
+}
+
+TEST(ReachabilityIndexTest, RandomDagMatchesDfs)
+{
+    const int n = 400;
+    std::mt19937 rng(5);
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "C" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 3;
+        for (int k = 0; k < 3 && i > 0; k++)
+            a.prerequisite.push_back("C" + std::to_string(rng() % i));
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+
+    ReachabilityIndex iv(g, ReachabilityIndex::Kind::Interval);
+    ReachabilityIndex bs(g, ReachabilityIndex::Kind::Bitset);
+    ReachabilityIndex au(g);
+    EXPECT_EQ(bs.memoryBytes(), ReachabilityIndex::bitsetBytes(n));
+    EXPECT_LE(au.memoryBytes(), bs.memoryBytes());
+    for (int u = 0; u < n; u++)
+    {
+        std::set<int> want = dfsFrom(g, u);
+        std::vector<int> wantVec(want.begin(), want.end());
+        EXPECT_EQ(iv.descendants(u), wantVec);
+        EXPECT_EQ(bs.descendants(u), wantVec);
+        EXPECT_EQ(iv.countDescendants(u), (int)want.size());
+        EXPECT_EQ(bs.countDescendants(u), (int)want.size());
+        for (int v = 0; v < n; v++)
+        {
+            bool r = want.count(v) > 0;
+            ASSERT_EQ(iv.reaches(u, v), r);
+            ASSERT_EQ(bs.reaches(u, v), r);
+            ASSERT_EQ(au.reaches(u, v), r);
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/SmallGraph.h"
+#include "graph/TopoSort.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "planner/LongestPathDag.h"
+#include "plan_test_helpers.h"
+#include <random>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+TEST(SmallGraphTest, LevelsMatchEarliestTerms)
+{
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {"A"}, {}};
+    Course d{"D", "D", 3, {"B", "C"}, {}};
+    Course e{"E", "E", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, c, d, e});
+    CourseGraph g;
+    g.build(curr);
+
+    SmallGraph<64> sg;
+    ASSERT_TRUE(sg.assign(g));
+    TopoResult topo;
+    std::vector<int> earliest;
+    sg.analyze(topo, earliest);
+    ASSERT_TRUE(topo.success);
+    EXPECT_FALSE(sg.hasCycle());
+    EXPECT_EQ(earliest[g.idToIdx.at("A")], 1);
+    EXPECT_EQ(earliest[g.idToIdx.at("E")], 1);
+    EXPECT_EQ(earliest[g.idToIdx.at("B")], 2);
+    EXPECT_EQ(earliest[g.idToIdx.at("C")], 2);
+    EXPECT_EQ(earliest[g.idToIdx.at("D")], 3);
+    EXPECT_EQ(topo.levelStart, (std::vector<int>{0, 2, 4, 5}));
+}
+
+TEST(SmallGraphTest, DetectsCycle)
+{
+    Course a{"A", "A", 3, {"C"}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    Course c{"C", "C", 3, {"B"}, {}};
+    Course d{"D", "D", 3, {}, {}};
+    Curriculum curr = makeCurriculum({a, b, c, d});
+    CourseGraph g;
+    g.build(curr);
+
+    SmallGraph<64> sg;
+    ASSERT_TRUE(sg.assign(g));
+    EXPECT_TRUE(sg.hasCycle());
+
+    TopoResult topo;
+    EarliestTerms et = topoAndEarliestTerms(g, topo);
+    EXPECT_FALSE(topo.success);
+    EXPECT_FALSE(et.ok);
+}
+
+TEST(SmallGraphTest, RejectsOverCapacity)
+{
+    Curriculum curr = randomCurriculum(65, 1, 1);
+    CourseGraph g;
+    g.build(curr);
+    SmallGraph<64> sg;
+    EXPECT_FALSE(sg.assign(g));
+    EXPECT_TRUE(SmallGraph<128>().assign(g));
+}
+
+TEST(SmallGraphTest, DispatchMatchesCsrPath)
+{
+    // 40 -> 64, 100 -> 128, 250 -> 256, 400 -> fallback CSR
+    for (int n : {40, 100, 250, 400})
+    {
+        Curriculum curr = randomCurriculum(n, 3, 7u + n);
+        CourseGraph g;
+        g.build(curr);
+
+        TopoResult ref = topoSortParallel(g);
+        ASSERT_TRUE(ref.success);
+        std::vector<int> refTerms = computeEarliestTerms(g, ref).termByIdx;
+
+        TopoResult topo;
+        std::vector<int> terms;
+        EXPECT_EQ(analyzeSmall(g, topo, terms), n <= 256);
+
+        EarliestTerms et = topoAndEarliestTerms(g, topo);
+        ASSERT_TRUE(topo.success);
+        ASSERT_TRUE(et.ok);
+        EXPECT_EQ(et.termByIdx, refTerms) << "n=" << n;
+        if (n <= 256)
+        {
+            EXPECT_EQ(topo.order, ref.order) << "n=" << n;
+            EXPECT_EQ(topo.levelStart, ref.levelStart) << "n=" << n;
+        }
+    }
+}
+
+TEST(SmallGraphTest, OfferedMasksStayOnFastPath)
+{
+    // Có kỳ mở: earliest của SmallGraph phải khớp computeEarliestTerms
+    for (int n : {30, 200})
+    {
+        Curriculum curr = randomCurriculum(n, 2, 31u + n);
+        CourseGraph g;
+        g.build(curr);
+        std::mt19937 rng(n);
+        for (int u = 0; u < g.V; u++)
+            if (rng() % 3 == 0)
+                g.offeredMask[u] = (rng() % 0xFFFF) + 1;
+
+        TopoResult ref = topoSortParallel(g);
+        EarliestTerms refTerms = computeEarliestTerms(g, ref);
+
+        TopoResult topo;
+        std::vector<int> terms;
+        bool ok = false;
+        ASSERT_TRUE(analyzeSmall(g, topo, terms, &ok));
+        ASSERT_TRUE(topo.success);
+        EXPECT_EQ(ok, refTerms.ok) << "n=" << n;
+        EXPECT_EQ(terms, refTerms.termByIdx) << "n=" << n;
+        EXPECT_EQ(topo.order, ref.order) << "n=" << n;
+
+        EarliestTerms et = topoAndEarliestTerms(g, topo);
+        EXPECT_EQ(et.ok, refTerms.ok);
+        EXPECT_EQ(et.termByIdx, refTerms.termByIdx);
+    }
+
+    // Không còn kỳ mở: ok = false như bản CSR
+    Course a{"A", "A", 3, {}, {}};
+    Course b{"B", "B", 3, {"A"}, {}};
+    b.offered_terms = {1};
+    Curriculum curr = makeCurriculum({a, b});
+    CourseGraph g;
+    g.build(curr);
+    TopoResult topo;
+    EarliestTerms et = topoAndEarliestTerms(g, topo);
+    EXPECT_TRUE(topo.success);
+    EXPECT_FALSE(et.ok);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/TopoSort.h"
+#include "io/Loader.h"
+#include "io/Snapshot.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "planner/LongestPathDag.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static std::string tempPath(const char *name)
+{
+    return std::string(::testing::TempDir()) + name;
+}
+
+TEST(SnapshotTest, RoundTripMatchesGraph)
+{
+    Course c1{"CALC1", "Calculus I", 3, {}, {}, std::nullopt, {1, 3}};
+    Course c2{"CALC2", "Calculus II", 4, {"CALC1"}, {}, std::nullopt, {2}};
+    Course c3{"PHYS", "Physics", 2, {"CALC1"}, {}};
+    Course c4{"EM", "Electromagnetism", 3, {"CALC2", "PHYS"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3, c4});
+    CourseGraph g;
+    g.build(curr);
+    const std::string path = tempPath("roundtrip.snap");
+    planner::writeSnapshot(path, curr, g);
+
+    planner::Snapshot s = planner::Snapshot::open(path);
+    ASSERT_EQ(s.numCourses(), g.V);
+    ASSERT_EQ(s.numEdges(), g.E);
+    ASSERT_TRUE(s.hasOrder());
+    TopoResult topo;
+    EarliestTerms et = topoAndEarliestTerms(g, topo);
+    for (int u = 0; u < g.V; u++)
+    {
+        EXPECT_EQ(s.id(u), g.idxToId[u]);
+        EXPECT_EQ(s.indexOf(g.idxToId[u]), u);
+        EXPECT_EQ(s.credits(u), curr.get(g.idxToId[u]).credits);
+        EXPECT_EQ(std::vector<int>(s.adj(u).begin(), s.adj(u).end()),
+                  std::vector<int>(g.adj[u].begin(), g.adj[u].end()));
+        EXPECT_EQ(std::vector<int>(s.radj(u).begin(), s.radj(u).end()),
+                  std::vector<int>(g.radj[u].begin(), g.radj[u].end()));
+        EXPECT_EQ(s.topoOrder()[u], topo.order[u]);
+        EXPECT_EQ(s.earliestTerms()[u], et.termByIdx[u]);
+    }
+    EXPECT_EQ(s.indexOf("NOPE"), -1);
+    EXPECT_EQ(s.offeredMask(g.idToIdx.at("CALC1")), 0b101u);
+    EXPECT_EQ(s.offeredMask(g.idToIdx.at("PHYS")), 0u);
+
+    // move giữ nguyên vùng map
+    planner::Snapshot moved = std::move(s);
+    EXPECT_EQ(moved.id(0), "CALC1");
+    std::remove(path.c_str());
+}
+
+TEST(SnapshotTest, CycleHasNoOrder)
+{
+    Course c1{"A", "A", 3, {"B"}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2});
+    CourseGraph g;
+    g.build(curr);
+    const std::string path = tempPath("cycle.snap");
+    planner::writeSnapshot(path, curr, g);
+    planner::Snapshot s = planner::Snapshot::open(path);
+    EXPECT_FALSE(s.hasOrder());
+    EXPECT_EQ(s.topoOrder(), nullptr);
+    EXPECT_EQ(s.numEdges(), 2);
+    std::remove(path.c_str());
+}
+
+TEST(SnapshotTest, CorruptionIsDetected)
+{
+    Course c1{"A", "A", 3, {}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2});
+    CourseGraph g;
+    g.build(curr);
+    const std::string path = tempPath("corrupt.snap");
+    planner::writeSnapshot(path, curr, g);
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-1, std::ios::end);
+        f.put('\x7f');
+    }
+    try
+    {
+        planner::Snapshot::open(path);
+        FAIL() << "expected checksum error";
+    }
+    catch (const planner::LoadException &e)
+    {
+        EXPECT_EQ(e.getErrorCode(), "SNAPSHOT_CHECKSUM");
+    }
+    EXPECT_NO_THROW(planner::Snapshot::open(path, false));
+
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.put('X');
+    }
+    try
+    {
+        planner::Snapshot::open(path, false);
+        FAIL() << "expected format error";
+    }
+    catch (const planner::LoadException &e)
+    {
+        EXPECT_EQ(e.getErrorCode(), "SNAPSHOT_FORMAT");
+    }
+    std::remove(path.c_str());
+}
+
+TEST(SnapshotTest, BadOffsetsRejectedWithoutChecksum)
+{
+    Course c1{"A", "A", 3, {}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Course c3{"C", "C", 3, {"A", "B"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    const std::string path = tempPath("offsets.snap");
+
+    // Ghi đè phần tử thứ i (uint32) của section rồi mở không kiểm checksum
+    auto expectRejected = [&](int sec, int i, std::uint32_t value)
+    {
+        planner::writeSnapshot(path, curr, g);
+        planner::SnapshotHeader h{};
+        {
+            std::ifstream in(path, std::ios::binary);
+            in.read(reinterpret_cast<char *>(&h), sizeof(h));
+        }
+        {
+            std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+            f.seekp(h.section[sec] + 4 * i);
+            f.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+        try
+        {
+            planner::Snapshot::open(path, false);
+            ADD_FAILURE() << "expected format error, section " << sec << " [" << i << "]";
+        }
+        catch (const planner::LoadException &e)
+        {
+            EXPECT_EQ(e.getErrorCode(), "SNAPSHOT_FORMAT");
+        }
+    };
+    expectRejected(planner::SEC_ADJ_OFFSET, 0, 1);       // offset[0] != 0
+    expectRejected(planner::SEC_ADJ_OFFSET, 1, 1000);    // vượt E, giảm ở offset[2]
+    expectRejected(planner::SEC_RADJ_OFFSET, 3, 2);      // offset[V] != E
+    expectRejected(planner::SEC_ID_OFFSET, 1, 3);        // giảm: offset[1] > offset[2]
+    expectRejected(planner::SEC_ADJ_TARGET, 0, 7);       // target >= V
+    expectRejected(planner::SEC_ID_SORTED, 2, 3);        // idSorted >= V
+
+    planner::writeSnapshot(path, curr, g);
+    EXPECT_NO_THROW(planner::Snapshot::open(path, false));
+    std::remove(path.c_str());
+}
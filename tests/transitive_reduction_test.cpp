@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/TopoSort.h"
+#include "graph/TransitiveReduction.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+// Tập node đạt được từ mỗi node (DFS), để so sánh trước/sau khi rút gọn
+static std::vector<std::set<int>> closure(const CourseGraph &g)
+{
+    std::vector<std::set<int>> out(g.V);
+    for (int s = 0; s < g.V; s++)
+    {
+        std::vector<int> st{s};
+        while (!st.empty())
+        {
+            int u = st.back();
+            st.pop_back();
+            for (int v : g.adj[u])
+                if (out[s].insert(v).second)
+                    st.push_back(v);
+        }
+    }
+    return out;
+}
+
+TEST(TransitiveReductionTest, RemovesRedundantPrereq)
+{
+    Course c1{"CALC1", "Calculus I", 3, {}, {}};
+    Course c2{"CALC2", "Calculus II", 3, {"CALC1"}, {}};
+    Course c3{"CALC3", "Calculus III", 3, {"CALC1", "CALC2", "CALC2"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2, c3});
+    CourseGraph g;
+    g.build(curr);
+    ReductionResult r = reduceTransitive(g);
+    EXPECT_TRUE(r.success);
+    ASSERT_EQ(r.removed.size(), 2);
+    std::set<std::pair<std::string, std::string>> removed;
+    for (const auto &e : r.removed)
+        removed.insert({g.idxToId[e.prereq], g.idxToId[e.course]});
+    EXPECT_TRUE(removed.count({"CALC1", "CALC3"}));
+    EXPECT_TRUE(removed.count({"CALC2", "CALC3"}));
+    EXPECT_EQ(g.E, 2);
+    EXPECT_EQ(g.indeg[g.idToIdx.at("CALC3")], 1);
+    EXPECT_EQ(g.radj[g.idToIdx.at("CALC3")][0], g.idToIdx.at("CALC2"));
+}
+
+TEST(TransitiveReductionTest, CycleLeavesGraphUntouched)
+{
+    Course c1{"A", "A", 3, {"B"}, {}};
+    Course c2{"B", "B", 3, {"A"}, {}};
+    Curriculum curr = makeCurriculum({c1, c2});
+    CourseGraph g;
+    g.build(curr);
+    ReductionResult r = reduceTransitive(g);
+    EXPECT_FALSE(r.success);
+    EXPECT_EQ(g.E, 2);
+}
+
+TEST(TransitiveReductionTest, RandomDagKeepsReachability)
+{
+    const int n = 300;
+    std::mt19937 rng(11);
+    std::vector<Course> courses;
+    for (int i = 0; i < n; i++)
+    {
+        Course a;
+        a.id = "C" + std::to_string(i);
+        a.name = a.id;
+        a.credits = 3;
+        for (int k = 0; k < 4 && i > 0; k++)
+            a.prerequisite.push_back("C" + std::to_string(rng() % i));
+        courses.push_back(a);
+    }
+    Curriculum curr = makeCurriculum(courses);
+    CourseGraph g;
+    g.build(curr);
+    auto before = closure(g);
+    int edgesBefore = g.E;
+
+    // bộ nhớ rất nhỏ để buộc chia nhiều khối cột
+    ReductionResult r = reduceTransitive(g, 8 * n);
+    EXPECT_TRUE(r.success);
+    EXPECT_EQ(g.E + (int)r.removed.size(), edgesBefore);
+    EXPECT_GT(r.removed.size(), 0u);
+    EXPECT_EQ(closure(g), before);
+    EXPECT_TRUE(topoSort(g).success);
+
+    // không còn cạnh nào thừa
+    ReductionResult again = reduceTransitive(g);
+    EXPECT_TRUE(again.removed.empty());
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "graph/CourseGraph.h"
+#include "graph/TopoSort.h"
+#include "model/Course.h"
+#include "model/Curriculum.h"
+#include "planner/LongestPathDag.h"
+#include "viz/DotExport.h"
+#include <sstream>
+
+static Curriculum makeCurriculum(const std::vector<Course> &courses)
+{
+    Curriculum curr;
+    for (const auto &c : courses)
+    {
+        curr.add(c);
+    }
+    return curr;
+}
+
+static size_t countOf(const std::string &s, const std::string &needle)
+{
+    size_t n = 0;
+    for (size_t p = s.find(needle); p != std::string::npos; p = s.find(needle, p + 1))
+        n++;
+    return n;
+}
+
+class VizExportTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Course c1{"CS101", "Intro", 3, {}, {}};
+        Course c2{"CS102", "Tech", 3, {"CS101"}, {}};
+        Course c3{"CS201", "DSA", 4, {"CS102"}, {}};
+        Course c4{"MATH\"1", "Calc", 3, {}, {}};
+        Course c5{"ENG<1>", "Eng", 2, {}, {}};
+        Course c6{"ENG2", "Eng II", 2, {"ENG<1>"}, {}};
+        curr = makeCurriculum({c1, c2, c3, c4, c5, c6});
+        g.build(curr);
+        earliest = computeEarliestTerms(g, topoSort(g)).termByIdx;
+        for (int u = 0; u < g.V; u++)
+        {
+            credits.push_back(curr.get(g.idxToId[u]).credits);
+            tracks.push_back(g.idxToId[u].substr(0, 2));
+        }
+    }
+
+    Curriculum curr;
+    CourseGraph g;
+    std::vector<int> earliest, credits;
+    std::vector<std::string> tracks;
+};
+
+TEST_F(VizExportTest, DotClustersByTermAndColorsByTrack)
+{
+    GraphExportOptions opt;
+    opt.termByIdx = &earliest;
+    opt.trackByIdx = &tracks;
+    opt.creditsByIdx = &credits;
+    std::ostringstream os;
+    writeDot(os, g, opt);
+    std::string dot = os.str();
+    EXPECT_EQ(dot.rfind("digraph Curriculum {", 0), 0u);
+    EXPECT_EQ(countOf(dot, "subgraph cluster_t"), 3u);
+    EXPECT_EQ(countOf(dot, " -> "), 3u);
+    EXPECT_NE(dot.find("label=\"CS201\\n(4)\""), std::string::npos);
+    EXPECT_NE(dot.find("MATH\\\"1"), std::string::npos);
+    EXPECT_EQ(countOf(dot, "fillcolor=\"#8dd3c7\""), 3u); // track "CS"
+}
+
+TEST_F(VizExportTest, FocusExtractsAncestorsOrDescendants)
+{
+    GraphExportOptions opt;
+    opt.focus = g.idToIdx.at("CS102");
+    std::ostringstream both;
+    writeDot(both, g, opt);
+    EXPECT_EQ(countOf(both.str(), "[label="), 3u);
+    EXPECT_EQ(countOf(both.str(), " -> "), 2u);
+
+    opt.descendants = false;
+    std::ostringstream up;
+    writeDot(up, g, opt);
+    EXPECT_EQ(countOf(up.str(), "[label="), 2u);
+    EXPECT_EQ(up.str().find("CS201"), std::string::npos);
+
+    opt.focus = g.V;
+    std::ostringstream bad;
+    EXPECT_THROW(writeDot(bad, g, opt), std::runtime_error);
+}
+
+TEST_F(VizExportTest, GraphMLEscapesAndCarriesAttributes)
+{
+    GraphExportOptions opt;
+    opt.termByIdx = &earliest;
+    opt.trackByIdx = &tracks;
+    std::ostringstream os;
+    writeGraphML(os, g, opt);
+    std::string xml = os.str();
+    EXPECT_EQ(countOf(xml, "<node "), 6u);
+    EXPECT_EQ(countOf(xml, "<edge "), 3u);
+    EXPECT_NE(xml.find("ENG&lt;1&gt;"), std::string::npos);
+    EXPECT_NE(xml.find("MATH&quot;1"), std::string::npos);
+    EXPECT_NE(xml.find("<key id=\"term\""), std::string::npos);
+    EXPECT_EQ(xml.find("<key id=\"credits\""), std::string::npos);
+    EXPECT_NE(xml.find("</graphml>"), std::string::npos);
+}
@@ -10,8 +10,9 @@
 using nlohmann::json;
 
 // ==== CORE ====
-#include "graph/CourseGraph.h"   // V, adj, indeg, idToIdx, idxToId  (Kahn inputs)  // :contentReference[oaicite:2]{index=2}
+#include "graph/CourseGraph.h"   // V, adj/radj (CSR), indeg, idToIdx, idxToId  (Kahn inputs)  // :contentReference[oaicite:2]{index=2}
 #include "graph/TopoSort.h"      // TopoResult { success, order }, topoSort(...)     // :contentReference[oaicite:3]{index=3}
+#include "planner/LongestPathDag.h" // topoAndEarliestTerms: SmallGraph khi V <= 256, còn lại Kahn CSR
 
 std::vector<std::string> topoFromJsonFile(const std::string& path)
 {
@@ -23,40 +24,33 @@ std::vector<std::string> topoFromJsonFile(const std::string& path)
     if (!J.contains("courses") || !J["courses"].is_array())
         throw std::runtime_error("JSON missing 'courses' array");
 
-    // 2) Gán chỉ số liên tục cho từng id
-    CourseGraph g;
-    int next = 0;
+    // 2) Tập id hợp lệ (để bỏ các prereq ngoài bảng như CEFR/chứng chỉ)
+    std::unordered_set<std::string> known;
     for (const auto& c : J["courses"]) {
-        const std::string id = c.at("id").get<std::string>();
-        if (!g.idToIdx.count(id)) {
-            g.idToIdx[id] = next++;
-            g.idxToId.push_back(id);
-        }
+        known.insert(c.at("id").get<std::string>());
     }
-    g.V = static_cast<int>(g.idxToId.size());
-    g.adj.assign(g.V, {});
-    g.indeg.assign(g.V, 0);
 
-    // 3) Tạo cạnh prereq -> course và tính indegree
+    // 3) Dựng Curriculum chỉ với cạnh prereq -> course hợp lệ, rồi build CSR bằng core.
+    //    id lặp lại không làm hỏng lần chạy: add() giữ vị trí đầu, lấy nội dung lần cuối
+    Curriculum cur;
     for (const auto& c : J["courses"]) {
-        const std::string id = c.at("id").get<std::string>();
-        int u = g.idToIdx.at(id); // course index
+        Course course{};
+        course.id = c.at("id").get<std::string>();
         if (c.contains("prereq")) {
             for (const auto& pre : c["prereq"]) {
                 const std::string p = pre.get<std::string>();
                 // chỉ thêm cạnh nếu prereq có trong danh sách môn
-                auto it = g.idToIdx.find(p);
-                if (it != g.idToIdx.end()) {
-                    int preIdx = it->second;
-                    g.adj[preIdx].push_back(u); // prereq -> course
-                    g.indeg[u]++;               // course có thêm 1 incoming
-                }
+                if (known.count(p)) course.prerequisite.push_back(p);
             }
         }
+        cur.add(course);
     }
+    CourseGraph g;
+    g.build(cur);
 
-    // 4) Topo sort bằng core
-    TopoResult r = topoSort(g);   // trả indices theo Kahn
+    // 4) Topo sort bằng core (qua bộ chọn đường nhanh)
+    TopoResult r;
+    topoAndEarliestTerms(g, r);   // trả indices theo tầng / Kahn
     std::vector<std::string> out;
     out.reserve(r.order.size());
     for (int ix : r.order) {